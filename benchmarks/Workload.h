@@ -0,0 +1,107 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <FuzzyNumber.h>
+#include <FuzzyNumberFactory.h>
+#include <Interval.h>
+
+namespace FuzzyMathBenchmarks
+{
+    using namespace FuzzyMath;
+
+    // Seed of all workloads, can be changed with --fuzzymath_seed=N on the command line and is stored in the context
+    // of the JSON output.
+    inline std::uint64_t workload_seed = 20240901;
+
+    // Number of objects in a workload. Benchmarks cycle through them, so branch predictors and caches do not see the
+    // same operands on every iteration.
+    inline constexpr size_t workload_size = 256;
+
+    // Seeded generator of random operands. Values are positive, so workloads can be used for division.
+    template <typename T>
+    class Workload
+    {
+      public:
+        explicit Workload( std::uint64_t seed = workload_seed ) : m_engine( seed ) {}
+
+        T number( double low = 1, double high = 10 )
+        {
+            return T( std::uniform_real_distribution<double>( low, high )( m_engine ) );
+        }
+
+        BasicInterval<T> interval()
+        {
+            std::array<double, 2> values = { sample(), sample() };
+            std::sort( values.begin(), values.end() );
+            return BasicInterval<T>( T( values[0] ), T( values[1] ) );
+        }
+
+        BasicFuzzyNumber<T> triangular( int number_of_cuts )
+        {
+            std::array<double, 3> values = { sample(), sample(), sample() };
+            std::sort( values.begin(), values.end() );
+            return BasicFuzzyNumberFactory<T>::triangular( T( values[0] ), T( values[1] ), T( values[2] ),
+                                                           number_of_cuts );
+        }
+
+        std::vector<T> numbers( size_t count = workload_size )
+        {
+            std::vector<T> result;
+            result.reserve( count );
+
+            for ( size_t i = 0; i < count; ++i )
+                result.push_back( number() );
+
+            return result;
+        }
+
+        std::vector<BasicInterval<T>> intervals( size_t count = workload_size )
+        {
+            std::vector<BasicInterval<T>> result;
+            result.reserve( count );
+
+            for ( size_t i = 0; i < count; ++i )
+                result.push_back( interval() );
+
+            return result;
+        }
+
+        std::vector<BasicFuzzyNumber<T>> fuzzy_numbers( int number_of_cuts, size_t count = workload_size )
+        {
+            std::vector<BasicFuzzyNumber<T>> result;
+            result.reserve( count );
+
+            for ( size_t i = 0; i < count; ++i )
+                result.push_back( triangular( number_of_cuts ) );
+
+            return result;
+        }
+
+        // Parameters of triangular fuzzy numbers, one column per parameter.
+        std::array<std::vector<T>, 3> triangular_parameters( size_t count = workload_size )
+        {
+            std::array<std::vector<T>, 3> columns;
+
+            for ( size_t i = 0; i < count; ++i )
+            {
+                std::array<double, 3> values = { sample(), sample(), sample() };
+                std::sort( values.begin(), values.end() );
+
+                for ( size_t c = 0; c < 3; ++c )
+                    columns[c].push_back( T( values[c] ) );
+            }
+
+            return columns;
+        }
+
+      private:
+        std::mt19937_64 m_engine;
+
+        double sample() { return std::uniform_real_distribution<double>( 1, 10 )( m_engine ); }
+    };
+} // namespace FuzzyMathBenchmarks
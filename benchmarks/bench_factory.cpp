@@ -0,0 +1,65 @@
+#include <benchmark/benchmark.h>
+
+#include <FuzzyNumberBatch.h>
+#include <FuzzyNumberFactory.h>
+
+#include "Workload.h"
+
+using namespace FuzzyMathBenchmarks;
+
+// Argument is number of alpha cuts.
+template <typename T>
+static void BM_FactoryTriangular( benchmark::State &state )
+{
+    Workload<T> workload;
+    std::array<std::vector<T>, 3> parameters = workload.triangular_parameters();
+    int cuts = static_cast<int>( state.range( 0 ) );
+
+    size_t i = 0;
+
+    for ( auto _ : state )
+    {
+        benchmark::DoNotOptimize(
+            BasicFuzzyNumberFactory<T>::triangular( parameters[0][i], parameters[1][i], parameters[2][i], cuts ) );
+        i = ( i + 1 ) % workload_size;
+    }
+
+    state.SetItemsProcessed( state.iterations() );
+}
+
+BENCHMARK_TEMPLATE( BM_FactoryTriangular, PreciseFloat )->RangeMultiplier( 4 )->Range( 2, 128 );
+BENCHMARK_TEMPLATE( BM_FactoryTriangular, double )->RangeMultiplier( 4 )->Range( 2, 128 );
+
+template <typename T>
+static void BM_FactoryTriangularString( benchmark::State &state )
+{
+    for ( auto _ : state )
+    {
+        benchmark::DoNotOptimize( BasicFuzzyNumberFactory<T>::triangular( "1.5", "2.25", "3.125" ) );
+    }
+
+    state.SetItemsProcessed( state.iterations() );
+}
+
+BENCHMARK_TEMPLATE( BM_FactoryTriangularString, PreciseFloat );
+BENCHMARK_TEMPLATE( BM_FactoryTriangularString, double );
+
+// Whole workload of triangular numbers built from columns of parameters. Argument is number of alpha cuts.
+template <typename T>
+static void BM_FactoryTriangularBatch( benchmark::State &state )
+{
+    Workload<T> workload;
+    std::array<std::vector<T>, 3> parameters = workload.triangular_parameters();
+    int cuts = static_cast<int>( state.range( 0 ) );
+
+    for ( auto _ : state )
+    {
+        benchmark::DoNotOptimize(
+            BasicFuzzyNumberFactory<T>::triangular_batch( parameters[0], parameters[1], parameters[2], cuts ) );
+    }
+
+    state.SetItemsProcessed( state.iterations() * static_cast<int64_t>( workload_size ) );
+}
+
+BENCHMARK_TEMPLATE( BM_FactoryTriangularBatch, PreciseFloat )->RangeMultiplier( 4 )->Range( 2, 128 );
+BENCHMARK_TEMPLATE( BM_FactoryTriangularBatch, double )->RangeMultiplier( 4 )->Range( 2, 128 );
@@ -0,0 +1,183 @@
+#include <functional>
+
+#include <benchmark/benchmark.h>
+
+#include <Functions.h>
+#include <FuzzyNumber.h>
+#include <FuzzyReduction.h>
+
+#include "Workload.h"
+
+using namespace FuzzyMathBenchmarks;
+
+// Argument is number of alpha cuts of operands.
+template <typename T, typename Op>
+static void BM_FuzzyNumberArithmetic( benchmark::State &state )
+{
+    Workload<T> workload;
+    int cuts = static_cast<int>( state.range( 0 ) );
+    std::vector<BasicFuzzyNumber<T>> lhs = workload.fuzzy_numbers( cuts );
+    std::vector<BasicFuzzyNumber<T>> rhs = workload.fuzzy_numbers( cuts );
+
+    size_t i = 0;
+
+    for ( auto _ : state )
+    {
+        BasicFuzzyNumber<T> result = Op()( lhs[i], rhs[i] );
+        benchmark::DoNotOptimize( result );
+        i = ( i + 1 ) % workload_size;
+    }
+
+    state.SetItemsProcessed( state.iterations() );
+}
+
+#define FUZZY_ARITHMETIC( T, Op )                                                                                      \
+    BENCHMARK_TEMPLATE( BM_FuzzyNumberArithmetic, T, Op )->RangeMultiplier( 4 )->Range( 2, 128 )
+
+FUZZY_ARITHMETIC( PreciseFloat, std::plus<> );
+FUZZY_ARITHMETIC( PreciseFloat, std::minus<> );
+FUZZY_ARITHMETIC( PreciseFloat, std::multiplies<> );
+FUZZY_ARITHMETIC( PreciseFloat, std::divides<> );
+FUZZY_ARITHMETIC( double, std::plus<> );
+FUZZY_ARITHMETIC( double, std::multiplies<> );
+
+// Operands with different alpha levels, which are merged. Argument is number of alpha cuts of the first operand, the
+// second one has one cut more.
+template <typename T>
+static void BM_FuzzyNumberMergedLevels( benchmark::State &state )
+{
+    Workload<T> workload;
+    int cuts = static_cast<int>( state.range( 0 ) );
+    std::vector<BasicFuzzyNumber<T>> lhs = workload.fuzzy_numbers( cuts );
+    std::vector<BasicFuzzyNumber<T>> rhs = workload.fuzzy_numbers( cuts + 1 );
+
+    size_t i = 0;
+
+    for ( auto _ : state )
+    {
+        BasicFuzzyNumber<T> result = lhs[i] * rhs[i];
+        benchmark::DoNotOptimize( result );
+        i = ( i + 1 ) % workload_size;
+    }
+
+    state.SetItemsProcessed( state.iterations() );
+}
+
+BENCHMARK_TEMPLATE( BM_FuzzyNumberMergedLevels, PreciseFloat )->RangeMultiplier( 4 )->Range( 2, 128 );
+BENCHMARK_TEMPLATE( BM_FuzzyNumberMergedLevels, double )->RangeMultiplier( 4 )->Range( 2, 128 );
+
+// Expression of several operations evaluated at once.
+template <typename T>
+static void BM_FuzzyNumberExpression( benchmark::State &state )
+{
+    Workload<T> workload;
+    int cuts = static_cast<int>( state.range( 0 ) );
+    std::vector<BasicFuzzyNumber<T>> a = workload.fuzzy_numbers( cuts );
+    std::vector<BasicFuzzyNumber<T>> b = workload.fuzzy_numbers( cuts );
+    std::vector<BasicFuzzyNumber<T>> c = workload.fuzzy_numbers( cuts );
+
+    size_t i = 0;
+
+    for ( auto _ : state )
+    {
+        BasicFuzzyNumber<T> result = a[i] * b[i] + c[i] / a[i] - 2 * b[i];
+        benchmark::DoNotOptimize( result );
+        i = ( i + 1 ) % workload_size;
+    }
+
+    state.SetItemsProcessed( state.iterations() );
+}
+
+BENCHMARK_TEMPLATE( BM_FuzzyNumberExpression, PreciseFloat )->RangeMultiplier( 4 )->Range( 2, 128 );
+BENCHMARK_TEMPLATE( BM_FuzzyNumberExpression, double )->RangeMultiplier( 4 )->Range( 2, 128 );
+
+// Arguments are number of alpha cuts and whether function is treated as monotone.
+template <typename T>
+static void BM_FuzzyNumberFunction( benchmark::State &state )
+{
+    Workload<T> workload;
+    std::vector<BasicFuzzyNumber<T>> numbers = workload.fuzzy_numbers( static_cast<int>( state.range( 0 ) ) );
+    bool monotone = state.range( 1 ) != 0;
+
+    auto square = []( const T &x ) { return x * x; };
+
+    size_t i = 0;
+
+    for ( auto _ : state )
+    {
+        BasicFuzzyNumber<T> result = numbers[i].apply_function( square, monotone, 1000 );
+        benchmark::DoNotOptimize( result );
+        i = ( i + 1 ) % workload_size;
+    }
+
+    state.SetItemsProcessed( state.iterations() );
+}
+
+BENCHMARK_TEMPLATE( BM_FuzzyNumberFunction, PreciseFloat )
+    ->ArgNames( { "cuts", "monotone" } )
+    ->ArgsProduct( { { 2, 11 }, { 0, 1 } } );
+BENCHMARK_TEMPLATE( BM_FuzzyNumberFunction, double )
+    ->ArgNames( { "cuts", "monotone" } )
+    ->ArgsProduct( { { 2, 11 }, { 0, 1 } } );
+
+// Alpha cut at random level between stored cuts, which is interpolated. Argument is number of alpha cuts.
+template <typename T>
+static void BM_AlphaCutInterpolation( benchmark::State &state )
+{
+    Workload<T> workload;
+    std::vector<BasicFuzzyNumber<T>> numbers = workload.fuzzy_numbers( static_cast<int>( state.range( 0 ) ) );
+    std::vector<T> alphas;
+
+    for ( size_t i = 0; i < workload_size; ++i )
+        alphas.push_back( workload.number( 0, 1 ) );
+
+    size_t i = 0;
+
+    for ( auto _ : state )
+    {
+        benchmark::DoNotOptimize( numbers[i].alpha_cut( alphas[i] ) );
+        i = ( i + 1 ) % workload_size;
+    }
+
+    state.SetItemsProcessed( state.iterations() );
+}
+
+BENCHMARK_TEMPLATE( BM_AlphaCutInterpolation, PreciseFloat )->RangeMultiplier( 4 )->Range( 2, 512 );
+BENCHMARK_TEMPLATE( BM_AlphaCutInterpolation, double )->RangeMultiplier( 4 )->Range( 2, 512 );
+
+// Sum of many fuzzy numbers, by left fold of operator+ and by tree reduction. Arguments are number of fuzzy numbers
+// and number of threads of the reduction, zero threads is the left fold.
+template <typename T>
+static void BM_FuzzyNumberSum( benchmark::State &state )
+{
+    Workload<T> workload;
+    std::vector<BasicFuzzyNumber<T>> numbers =
+        workload.fuzzy_numbers( 11, static_cast<size_t>( state.range( 0 ) ) );
+    size_t threads = static_cast<size_t>( state.range( 1 ) );
+
+    for ( auto _ : state )
+    {
+        if ( threads == 0 )
+        {
+            BasicFuzzyNumber<T> result = numbers.front();
+            for ( size_t i = 1; i < numbers.size(); ++i )
+                result = result + numbers[i];
+            benchmark::DoNotOptimize( result );
+        }
+        else
+        {
+            benchmark::DoNotOptimize( BasicFuzzyReduction<T>::sum( numbers, threads ) );
+        }
+    }
+
+    state.SetItemsProcessed( state.iterations() * state.range( 0 ) );
+}
+
+BENCHMARK_TEMPLATE( BM_FuzzyNumberSum, PreciseFloat )
+    ->ArgNames( { "numbers", "threads" } )
+    ->ArgsProduct( { { 1 << 12, 1 << 16 }, { 0, 1, 4 } } )
+    ->UseRealTime();
+BENCHMARK_TEMPLATE( BM_FuzzyNumberSum, double )
+    ->ArgNames( { "numbers", "threads" } )
+    ->ArgsProduct( { { 1 << 12, 1 << 16 }, { 0, 1, 4 } } )
+    ->UseRealTime();
@@ -0,0 +1,87 @@
+#include <functional>
+
+#include <benchmark/benchmark.h>
+
+#include <Functions.h>
+#include <Interval.h>
+
+#include "Workload.h"
+
+using namespace FuzzyMathBenchmarks;
+
+template <typename T, typename Op>
+static void BM_IntervalArithmetic( benchmark::State &state )
+{
+    Workload<T> workload;
+    std::vector<BasicInterval<T>> lhs = workload.intervals();
+    std::vector<BasicInterval<T>> rhs = workload.intervals();
+
+    size_t i = 0;
+
+    for ( auto _ : state )
+    {
+        benchmark::DoNotOptimize( Op()( lhs[i], rhs[i] ) );
+        i = ( i + 1 ) % workload_size;
+    }
+
+    state.SetItemsProcessed( state.iterations() );
+}
+
+BENCHMARK_TEMPLATE( BM_IntervalArithmetic, PreciseFloat, std::plus<> );
+BENCHMARK_TEMPLATE( BM_IntervalArithmetic, PreciseFloat, std::minus<> );
+BENCHMARK_TEMPLATE( BM_IntervalArithmetic, PreciseFloat, std::multiplies<> );
+BENCHMARK_TEMPLATE( BM_IntervalArithmetic, PreciseFloat, std::divides<> );
+BENCHMARK_TEMPLATE( BM_IntervalArithmetic, double, std::plus<> );
+BENCHMARK_TEMPLATE( BM_IntervalArithmetic, double, std::minus<> );
+BENCHMARK_TEMPLATE( BM_IntervalArithmetic, double, std::multiplies<> );
+BENCHMARK_TEMPLATE( BM_IntervalArithmetic, double, std::divides<> );
+
+template <typename T>
+static void BM_IntervalScalar( benchmark::State &state )
+{
+    Workload<T> workload;
+    std::vector<BasicInterval<T>> intervals = workload.intervals();
+    std::vector<T> numbers = workload.numbers();
+
+    size_t i = 0;
+
+    for ( auto _ : state )
+    {
+        benchmark::DoNotOptimize( intervals[i] * numbers[i] + numbers[i] );
+        i = ( i + 1 ) % workload_size;
+    }
+
+    state.SetItemsProcessed( state.iterations() );
+}
+
+BENCHMARK_TEMPLATE( BM_IntervalScalar, PreciseFloat );
+BENCHMARK_TEMPLATE( BM_IntervalScalar, double );
+
+// Argument is number of sampled elements.
+template <typename T>
+static void BM_IntervalFunction( benchmark::State &state )
+{
+    Workload<T> workload;
+    std::vector<BasicInterval<T>> intervals = workload.intervals();
+    bool monotone = state.range( 1 ) != 0;
+
+    // Increasing on positive intervals, non-monotone case samples the same function.
+    auto square = []( const T &x ) { return x * x; };
+
+    size_t i = 0;
+
+    for ( auto _ : state )
+    {
+        benchmark::DoNotOptimize( intervals[i].apply_function( square, monotone, state.range( 0 ) ) );
+        i = ( i + 1 ) % workload_size;
+    }
+
+    state.SetItemsProcessed( state.iterations() );
+}
+
+BENCHMARK_TEMPLATE( BM_IntervalFunction, PreciseFloat )
+    ->ArgNames( { "elements", "monotone" } )
+    ->ArgsProduct( { { 100, 1000 }, { 0, 1 } } );
+BENCHMARK_TEMPLATE( BM_IntervalFunction, double )
+    ->ArgNames( { "elements", "monotone" } )
+    ->ArgsProduct( { { 100, 1000 }, { 0, 1 } } );
@@ -0,0 +1,35 @@
+#include <cstring>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include "Workload.h"
+
+int main( int argc, char **argv )
+{
+    // Remove own argument before Google Benchmark checks for unrecognized ones.
+    const char *seed_flag = "--fuzzymath_seed=";
+    int count = 0;
+
+    for ( int i = 0; i < argc; ++i )
+    {
+        if ( std::strncmp( argv[i], seed_flag, std::strlen( seed_flag ) ) == 0 )
+            FuzzyMathBenchmarks::workload_seed = std::stoull( argv[i] + std::strlen( seed_flag ) );
+        else
+            argv[count++] = argv[i];
+    }
+
+    argc = count;
+
+    benchmark::Initialize( &argc, argv );
+
+    if ( benchmark::ReportUnrecognizedArguments( argc, argv ) )
+        return 1;
+
+    benchmark::AddCustomContext( "fuzzymath_seed", std::to_string( FuzzyMathBenchmarks::workload_seed ) );
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+
+    return 0;
+}
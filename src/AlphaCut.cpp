@@ -2,12 +2,15 @@
 
 using namespace FuzzyMath;
 
-AlphaCut::AlphaCut( const PreciseFloat &alpha )
-    : AlphaCut( alpha, Interval( -std::numeric_limits<PreciseFloat>::max(), std::numeric_limits<PreciseFloat>::max() ) )
+template <typename T>
+BasicAlphaCut<T>::BasicAlphaCut( const T &alpha )
+    : BasicAlphaCut( alpha, BasicInterval<T>( -std::numeric_limits<T>::max(), std::numeric_limits<T>::max() ) )
 {
 }
 
-AlphaCut::AlphaCut( const PreciseFloat &alpha, const Interval &interval ) : m_alpha( alpha ), m_interval( interval )
+template <typename T>
+BasicAlphaCut<T>::BasicAlphaCut( const T &alpha, const BasicInterval<T> &interval )
+    : m_alpha( alpha ), m_interval( interval )
 {
     if ( alpha < 0 || alpha > 1 )
     {
@@ -19,18 +22,22 @@ AlphaCut::AlphaCut( const PreciseFloat &alpha, const Interval &interval ) : m_al
     }
 }
 
-PreciseFloat AlphaCut::alpha() const { return m_alpha; }
+template <typename T>
+T BasicAlphaCut<T>::alpha() const { return m_alpha; }
 
-Interval AlphaCut::interval() const { return m_interval; }
+template <typename T>
+BasicInterval<T> BasicAlphaCut<T>::interval() const { return m_interval; }
 
-std::string AlphaCut::to_string() const
+template <typename T>
+std::string BasicAlphaCut<T>::to_string() const
 {
     std::ostringstream oss;
     oss << "AlphaCut(alpha: " << m_alpha << ", interval: " << m_interval.to_string() << ")";
     return oss.str();
 }
 
-bool AlphaCut::contains( const AlphaCut &other ) const
+template <typename T>
+bool BasicAlphaCut<T>::contains( const BasicAlphaCut &other ) const
 {
     if ( m_alpha > other.m_alpha )
     {
@@ -40,20 +47,24 @@ bool AlphaCut::contains( const AlphaCut &other ) const
     return m_interval.contains( other.m_interval );
 }
 
-AlphaCut AlphaCut::apply_function( const std::function<PreciseFloat( const PreciseFloat & )> &func, bool monotone,
-                                   size_t number_elements ) const
+template <typename T>
+BasicAlphaCut<T> BasicAlphaCut<T>::apply_function( const std::function<T( const T & )> &func, bool monotone,
+                                                   size_t number_elements ) const
 {
-    return AlphaCut( m_alpha, m_interval.apply_function( func, monotone, number_elements ) );
+    return BasicAlphaCut( m_alpha, m_interval.apply_function( func, monotone, number_elements ) );
 }
 
-bool AlphaCut::operator==( const AlphaCut &other ) const
+template <typename T>
+bool BasicAlphaCut<T>::operator==( const BasicAlphaCut &other ) const
 {
     return m_alpha == other.m_alpha && m_interval == other.m_interval;
 }
 
-AlphaCut AlphaCut::operator-() const { return AlphaCut( m_alpha, -m_interval ); }
+template <typename T>
+BasicAlphaCut<T> BasicAlphaCut<T>::operator-() const { return BasicAlphaCut( m_alpha, -m_interval ); }
 
-std::weak_ordering AlphaCut::operator<=>( const AlphaCut &other ) const
+template <typename T>
+std::weak_ordering BasicAlphaCut<T>::operator<=>( const BasicAlphaCut &other ) const
 {
     if ( m_alpha < other.m_alpha )
         return std::weak_ordering::less;
@@ -61,3 +72,10 @@ std::weak_ordering AlphaCut::operator<=>( const AlphaCut &other ) const
         return std::weak_ordering::greater;
     return std::weak_ordering::equivalent;
 }
+
+template class DLL_API FuzzyMath::BasicAlphaCut<PreciseFloat>;
+template class DLL_API FuzzyMath::BasicAlphaCut<double>;
+template class DLL_API FuzzyMath::BasicAlphaCut<long double>;
+#ifdef FUZZYMATH_HAS_FLOAT128
+template class DLL_API FuzzyMath::BasicAlphaCut<QuadFloat>;
+#endif
@@ -0,0 +1,557 @@
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+
+#include <boost/core/nvp.hpp>
+
+#include "BinarySerializer.h"
+
+using namespace FuzzyMath;
+
+namespace
+{
+    constexpr std::array<std::byte, 4> magic = { std::byte( 'F' ), std::byte( 'Z' ), std::byte( 'M' ),
+                                                 std::byte( 'B' ) };
+
+    enum class RecordKind : std::uint8_t
+    {
+        Interval = 1,
+        AlphaCut = 2,
+        FuzzyNumber = 3
+    };
+
+    template <typename U>
+    void write_integer( std::byte *out, U value )
+    {
+        for ( size_t i = 0; i < sizeof( U ); ++i )
+        {
+            out[i] = static_cast<std::byte>( ( value >> ( 8 * i ) ) & 0xFF );
+        }
+    }
+
+    template <typename U>
+    U read_integer( const std::byte *in )
+    {
+        U value = 0;
+
+        for ( size_t i = 0; i < sizeof( U ); ++i )
+        {
+            value |= static_cast<U>( std::to_integer<U>( in[i] ) << ( 8 * i ) );
+        }
+
+        return value;
+    }
+
+    // Unsigned integer type used to store field of cpp_dec_float backend.
+    template <typename U>
+    struct field_bits
+    {
+        using type = std::make_unsigned_t<U>;
+    };
+
+    template <>
+    struct field_bits<bool>
+    {
+        using type = std::uint8_t;
+    };
+
+    template <typename U>
+        requires std::is_enum_v<U>
+    struct field_bits<U>
+    {
+        using type = std::make_unsigned_t<std::underlying_type_t<U>>;
+    };
+
+    template <typename U>
+    using field_bits_t = typename field_bits<U>::type;
+
+    // Archives for serialize() of cpp_dec_float backend, which visits its limbs, exponent, sign, class and precision
+    // in a fixed order. Every field is stored as little endian integer of its own size.
+    class LimbCounter
+    {
+      public:
+        template <typename U>
+        LimbCounter &operator&( const boost::serialization::nvp<U> & )
+        {
+            m_size += sizeof( field_bits_t<U> );
+            return *this;
+        }
+
+        size_t size() const { return m_size; }
+
+      private:
+        size_t m_size = 0;
+    };
+
+    class LimbWriter
+    {
+      public:
+        explicit LimbWriter( std::byte *out ) : m_out( out ) {}
+
+        template <typename U>
+        LimbWriter &operator&( const boost::serialization::nvp<U> &field )
+        {
+            write_integer( m_out, static_cast<field_bits_t<U>>( field.const_value() ) );
+            m_out += sizeof( field_bits_t<U> );
+            return *this;
+        }
+
+      private:
+        std::byte *m_out;
+    };
+
+    class LimbReader
+    {
+      public:
+        explicit LimbReader( const std::byte *in ) : m_in( in ) {}
+
+        template <typename U>
+        LimbReader &operator&( const boost::serialization::nvp<U> &field )
+        {
+            field.value() = static_cast<U>( read_integer<field_bits_t<U>>( m_in ) );
+            m_in += sizeof( field_bits_t<U> );
+            return *this;
+        }
+
+      private:
+        const std::byte *m_in;
+    };
+
+    template <typename T>
+    constexpr bool has_limbs = std::is_same_v<T, PreciseFloat>;
+
+    // Bytes of hardware floating point value in little endian order.
+    template <typename V>
+    void write_raw( std::byte *out, const V &value )
+    {
+        std::memcpy( out, &value, sizeof( V ) );
+
+        if constexpr ( std::endian::native == std::endian::big )
+        {
+            std::reverse( out, out + sizeof( V ) );
+        }
+    }
+
+    template <typename V>
+    void read_raw( const std::byte *in, V &value )
+    {
+        if constexpr ( std::endian::native == std::endian::big )
+        {
+            std::array<std::byte, sizeof( V )> bytes;
+            std::reverse_copy( in, in + sizeof( V ), bytes.begin() );
+            std::memcpy( &value, bytes.data(), sizeof( V ) );
+        }
+        else
+        {
+            std::memcpy( &value, in, sizeof( V ) );
+        }
+    }
+
+    template <typename T>
+    size_t encoded_size( BinaryEncoding encoding )
+    {
+        if ( encoding == BinaryEncoding::Double )
+            return sizeof( double );
+
+        if constexpr ( has_limbs<T> )
+        {
+            static const size_t size = []()
+            {
+                LimbCounter counter;
+                T().backend().serialize( counter, 0 );
+                return counter.size();
+            }();
+            return size;
+        }
+        else
+        {
+            return sizeof( T );
+        }
+    }
+
+    // Packed array of numbers. Native hardware floating point values on little endian machines are copied at once.
+    template <typename T>
+    std::byte *write_values( std::byte *out, std::span<const T> values, BinaryEncoding encoding, size_t size )
+    {
+        if ( encoding == BinaryEncoding::Double )
+        {
+            for ( const T &value : values )
+            {
+                write_raw( out, static_cast<double>( value ) );
+                out += size;
+            }
+        }
+        else if constexpr ( has_limbs<T> )
+        {
+            for ( const T &value : values )
+            {
+                LimbWriter writer( out );
+                const_cast<T &>( value ).backend().serialize( writer, 0 );
+                out += size;
+            }
+        }
+        else if constexpr ( std::endian::native == std::endian::little )
+        {
+            std::memcpy( out, values.data(), values.size() * size );
+            out += values.size() * size;
+        }
+        else
+        {
+            for ( const T &value : values )
+            {
+                write_raw( out, value );
+                out += size;
+            }
+        }
+
+        return out;
+    }
+
+    template <typename T>
+    const std::byte *read_values( const std::byte *in, std::span<T> values, BinaryEncoding encoding, size_t size )
+    {
+        if ( encoding == BinaryEncoding::Double )
+        {
+            for ( T &value : values )
+            {
+                double number;
+                read_raw( in, number );
+                value = T( number );
+                in += size;
+            }
+        }
+        else if constexpr ( has_limbs<T> )
+        {
+            for ( T &value : values )
+            {
+                LimbReader reader( in );
+                value.backend().serialize( reader, 0 );
+                in += size;
+            }
+        }
+        else if constexpr ( std::endian::native == std::endian::little )
+        {
+            std::memcpy( values.data(), in, values.size() * size );
+            in += values.size() * size;
+        }
+        else
+        {
+            for ( T &value : values )
+            {
+                read_raw( in, value );
+                in += size;
+            }
+        }
+
+        return in;
+    }
+
+    std::byte *write_header( std::byte *out, RecordKind kind, BinaryEncoding encoding, size_t size, size_t count,
+                             std::uint16_t version )
+    {
+        std::copy( magic.begin(), magic.end(), out );
+        write_integer( out + 4, version );
+        write_integer( out + 6, static_cast<std::uint8_t>( kind ) );
+        write_integer( out + 7, static_cast<std::uint8_t>( encoding ) );
+        write_integer( out + 8, static_cast<std::uint32_t>( size ) );
+        write_integer( out + 12, static_cast<std::uint64_t>( count ) );
+        return out + 20;
+    }
+
+    // Reads data from the front of a span, throwing on truncated data.
+    class Cursor
+    {
+      public:
+        explicit Cursor( std::span<const std::byte> data ) : m_data( data ) {}
+
+        const std::byte *take( size_t bytes )
+        {
+            if ( bytes > m_data.size() - m_position )
+            {
+                throw std::invalid_argument( "Binary data is truncated." );
+            }
+
+            const std::byte *position = m_data.data() + m_position;
+            m_position += bytes;
+            return position;
+        }
+
+        bool at_end() const { return m_position == m_data.size(); }
+
+      private:
+        std::span<const std::byte> m_data;
+        size_t m_position = 0;
+    };
+
+    struct Header
+    {
+        BinaryEncoding encoding;
+        size_t value_size;
+        size_t count;
+    };
+
+    template <typename T>
+    Header read_header( Cursor &cursor, RecordKind kind, std::uint16_t version )
+    {
+        const std::byte *in = cursor.take( 20 );
+
+        if ( !std::equal( magic.begin(), magic.end(), in ) )
+        {
+            throw std::invalid_argument( "Binary data does not start with FuzzyMath header." );
+        }
+
+        if ( read_integer<std::uint16_t>( in + 4 ) != version )
+        {
+            throw std::invalid_argument( "Unsupported version of binary format." );
+        }
+
+        if ( read_integer<std::uint8_t>( in + 6 ) != static_cast<std::uint8_t>( kind ) )
+        {
+            throw std::invalid_argument( "Binary data contains records of different kind." );
+        }
+
+        std::uint8_t encoding = read_integer<std::uint8_t>( in + 7 );
+
+        if ( encoding != static_cast<std::uint8_t>( BinaryEncoding::Double ) &&
+             encoding != static_cast<std::uint8_t>( BinaryEncoding::Native ) )
+        {
+            throw std::invalid_argument( "Unknown encoding of binary data." );
+        }
+
+        Header header{ static_cast<BinaryEncoding>( encoding ), read_integer<std::uint32_t>( in + 8 ),
+                       static_cast<size_t>( read_integer<std::uint64_t>( in + 12 ) ) };
+
+        if ( header.value_size != encoded_size<T>( header.encoding ) )
+        {
+            throw std::invalid_argument( "Binary data was written for different number type." );
+        }
+
+        return header;
+    }
+
+    template <typename R>
+    R single_record( std::vector<R> records )
+    {
+        if ( records.size() != 1 )
+        {
+            throw std::invalid_argument( "Binary data must contain exactly one record." );
+        }
+
+        return std::move( records.front() );
+    }
+} // namespace
+
+template <typename T>
+size_t BasicBinarySerializer<T>::value_size( BinaryEncoding encoding )
+{
+    return encoded_size<T>( encoding );
+}
+
+template <typename T>
+std::vector<std::byte> BasicBinarySerializer<T>::serialize( const BasicInterval<T> &interval, BinaryEncoding encoding )
+{
+    return serialize( std::span<const BasicInterval<T>>( &interval, 1 ), encoding );
+}
+
+template <typename T>
+std::vector<std::byte> BasicBinarySerializer<T>::serialize( const BasicAlphaCut<T> &alpha_cut,
+                                                            BinaryEncoding encoding )
+{
+    return serialize( std::span<const BasicAlphaCut<T>>( &alpha_cut, 1 ), encoding );
+}
+
+template <typename T>
+std::vector<std::byte> BasicBinarySerializer<T>::serialize( const BasicFuzzyNumber<T> &fuzzy_number,
+                                                            BinaryEncoding encoding )
+{
+    return serialize( std::span<const BasicFuzzyNumber<T>>( &fuzzy_number, 1 ), encoding );
+}
+
+template <typename T>
+std::vector<std::byte> BasicBinarySerializer<T>::serialize( std::span<const BasicInterval<T>> intervals,
+                                                            BinaryEncoding encoding )
+{
+    size_t size = value_size( encoding );
+    std::vector<std::byte> data( header_size + intervals.size() * 2 * size );
+
+    std::byte *out =
+        write_header( data.data(), RecordKind::Interval, encoding, size, intervals.size(), format_version );
+
+    for ( const BasicInterval<T> &interval : intervals )
+    {
+        std::array<T, 2> values = { interval.min(), interval.max() };
+        out = write_values<T>( out, values, encoding, size );
+    }
+
+    return data;
+}
+
+template <typename T>
+std::vector<std::byte> BasicBinarySerializer<T>::serialize( std::span<const BasicAlphaCut<T>> alpha_cuts,
+                                                            BinaryEncoding encoding )
+{
+    size_t size = value_size( encoding );
+    std::vector<std::byte> data( header_size + alpha_cuts.size() * 3 * size );
+
+    std::byte *out =
+        write_header( data.data(), RecordKind::AlphaCut, encoding, size, alpha_cuts.size(), format_version );
+
+    for ( const BasicAlphaCut<T> &alpha_cut : alpha_cuts )
+    {
+        BasicInterval<T> interval = alpha_cut.interval();
+        std::array<T, 3> values = { alpha_cut.alpha(), interval.min(), interval.max() };
+        out = write_values<T>( out, values, encoding, size );
+    }
+
+    return data;
+}
+
+template <typename T>
+std::vector<std::byte> BasicBinarySerializer<T>::serialize( std::span<const BasicFuzzyNumber<T>> fuzzy_numbers,
+                                                            BinaryEncoding encoding )
+{
+    size_t size = value_size( encoding );
+    size_t total = header_size;
+
+    for ( const BasicFuzzyNumber<T> &fuzzy_number : fuzzy_numbers )
+    {
+        total += sizeof( std::uint64_t ) + fuzzy_number.size() * 3 * size;
+    }
+
+    std::vector<std::byte> data( total );
+
+    std::byte *out =
+        write_header( data.data(), RecordKind::FuzzyNumber, encoding, size, fuzzy_numbers.size(), format_version );
+
+    for ( const BasicFuzzyNumber<T> &fuzzy_number : fuzzy_numbers )
+    {
+        write_integer( out, static_cast<std::uint64_t>( fuzzy_number.size() ) );
+        out += sizeof( std::uint64_t );
+
+        out = write_values( out, fuzzy_number.alpha_levels(), encoding, size );
+        out = write_values( out, fuzzy_number.lower_bounds(), encoding, size );
+        out = write_values( out, fuzzy_number.upper_bounds(), encoding, size );
+    }
+
+    return data;
+}
+
+template <typename T>
+std::vector<BasicInterval<T>> BasicBinarySerializer<T>::deserialize_intervals( std::span<const std::byte> data )
+{
+    Cursor cursor( data );
+    Header header = read_header<T>( cursor, RecordKind::Interval, format_version );
+
+    const std::byte *in = cursor.take( header.count * 2 * header.value_size );
+
+    std::vector<BasicInterval<T>> intervals;
+    intervals.reserve( header.count );
+
+    for ( size_t i = 0; i < header.count; ++i )
+    {
+        std::array<T, 2> values;
+        in = read_values<T>( in, values, header.encoding, header.value_size );
+        intervals.emplace_back( values[0], values[1] );
+    }
+
+    if ( !cursor.at_end() )
+    {
+        throw std::invalid_argument( "Binary data has trailing bytes." );
+    }
+
+    return intervals;
+}
+
+template <typename T>
+std::vector<BasicAlphaCut<T>> BasicBinarySerializer<T>::deserialize_alpha_cuts( std::span<const std::byte> data )
+{
+    Cursor cursor( data );
+    Header header = read_header<T>( cursor, RecordKind::AlphaCut, format_version );
+
+    const std::byte *in = cursor.take( header.count * 3 * header.value_size );
+
+    std::vector<BasicAlphaCut<T>> alpha_cuts;
+    alpha_cuts.reserve( header.count );
+
+    for ( size_t i = 0; i < header.count; ++i )
+    {
+        std::array<T, 3> values;
+        in = read_values<T>( in, values, header.encoding, header.value_size );
+        alpha_cuts.emplace_back( values[0], BasicInterval<T>( values[1], values[2] ) );
+    }
+
+    if ( !cursor.at_end() )
+    {
+        throw std::invalid_argument( "Binary data has trailing bytes." );
+    }
+
+    return alpha_cuts;
+}
+
+template <typename T>
+std::vector<BasicFuzzyNumber<T>> BasicBinarySerializer<T>::deserialize_fuzzy_numbers( std::span<const std::byte> data )
+{
+    Cursor cursor( data );
+    Header header = read_header<T>( cursor, RecordKind::FuzzyNumber, format_version );
+
+    std::vector<BasicFuzzyNumber<T>> fuzzy_numbers;
+    fuzzy_numbers.reserve( std::min( header.count, data.size() / sizeof( std::uint64_t ) ) );
+
+    for ( size_t i = 0; i < header.count; ++i )
+    {
+        size_t cuts = static_cast<size_t>( read_integer<std::uint64_t>( cursor.take( sizeof( std::uint64_t ) ) ) );
+
+        if ( cuts > data.size() / ( 3 * header.value_size ) )
+        {
+            throw std::invalid_argument( "Binary data is truncated." );
+        }
+
+        const std::byte *in = cursor.take( cuts * 3 * header.value_size );
+
+        typename BasicFuzzyNumber<T>::storage_type alphas( cuts, memory_resource() );
+        typename BasicFuzzyNumber<T>::storage_type lower( cuts, memory_resource() );
+        typename BasicFuzzyNumber<T>::storage_type upper( cuts, memory_resource() );
+
+        in = read_values<T>( in, alphas, header.encoding, header.value_size );
+        in = read_values<T>( in, lower, header.encoding, header.value_size );
+        in = read_values<T>( in, upper, header.encoding, header.value_size );
+
+        // Data may come from elsewhere, so the fuzzy number is validated.
+        fuzzy_numbers.emplace_back( std::move( alphas ), std::move( lower ), std::move( upper ) );
+    }
+
+    if ( !cursor.at_end() )
+    {
+        throw std::invalid_argument( "Binary data has trailing bytes." );
+    }
+
+    return fuzzy_numbers;
+}
+
+template <typename T>
+BasicInterval<T> BasicBinarySerializer<T>::deserialize_interval( std::span<const std::byte> data )
+{
+    return single_record( deserialize_intervals( data ) );
+}
+
+template <typename T>
+BasicAlphaCut<T> BasicBinarySerializer<T>::deserialize_alpha_cut( std::span<const std::byte> data )
+{
+    return single_record( deserialize_alpha_cuts( data ) );
+}
+
+template <typename T>
+BasicFuzzyNumber<T> BasicBinarySerializer<T>::deserialize_fuzzy_number( std::span<const std::byte> data )
+{
+    return single_record( deserialize_fuzzy_numbers( data ) );
+}
+
+template class DLL_API FuzzyMath::BasicBinarySerializer<PreciseFloat>;
+template class DLL_API FuzzyMath::BasicBinarySerializer<double>;
+template class DLL_API FuzzyMath::BasicBinarySerializer<long double>;
+#ifdef FUZZYMATH_HAS_FLOAT128
+template class DLL_API FuzzyMath::BasicBinarySerializer<QuadFloat>;
+#endif
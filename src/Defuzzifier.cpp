@@ -0,0 +1,283 @@
+#include <cmath>
+#include <stdexcept>
+
+#include "Defuzzifier.h"
+
+using namespace FuzzyMath;
+
+namespace
+{
+    // Alpha cuts of a fuzzy number or of a row of a batch as columns.
+    template <typename T>
+    struct Cuts
+    {
+        std::span<const T> alphas;
+        std::span<const T> lower;
+        std::span<const T> upper;
+
+        size_t last() const { return alphas.size() - 1; }
+    };
+
+    template <typename T>
+    Cuts<T> cuts_of( const BasicFuzzyNumber<T> &number )
+    {
+        return Cuts<T>{ number.alpha_levels(), number.lower_bounds(), number.upper_bounds() };
+    }
+
+    // Integral of values over alpha, values are linear between alpha levels.
+    template <typename T>
+    T integral( std::span<const T> alphas, std::span<const T> values )
+    {
+        T result = T( 0 );
+
+        for ( size_t k = 0; k + 1 < alphas.size(); ++k )
+        {
+            result += ( alphas[k + 1] - alphas[k] ) * ( values[k] + values[k + 1] );
+        }
+
+        return result / 2;
+    }
+
+    template <typename T>
+    T mean_of_maxima( const Cuts<T> &cuts )
+    {
+        return ( cuts.lower[cuts.last()] + cuts.upper[cuts.last()] ) / 2;
+    }
+
+    template <typename T>
+    BasicInterval<T> expected_interval( const Cuts<T> &cuts )
+    {
+        return BasicInterval<T>( integral( cuts.alphas, cuts.lower ), integral( cuts.alphas, cuts.upper ) );
+    }
+
+    template <typename T>
+    T expected_value( const Cuts<T> &cuts )
+    {
+        return expected_interval( cuts ).mid_point();
+    }
+
+    template <typename T>
+    T graded_mean( const Cuts<T> &cuts )
+    {
+        // Integral of alpha times the midpoint of alpha cut, divided by the integral of alpha, which is 1/2. The
+        // integrand is quadratic between alpha levels, so Simpson's rule is exact. Both bounds are summed before the
+        // single division, to round once.
+        T result = T( 0 );
+
+        for ( size_t k = 0; k < cuts.last(); ++k )
+        {
+            const T &a = cuts.alphas[k];
+            const T &b = cuts.alphas[k + 1];
+            result += ( b - a ) * ( ( cuts.lower[k] + cuts.upper[k] ) * ( 2 * a + b ) +
+                                    ( cuts.lower[k + 1] + cuts.upper[k + 1] ) * ( a + 2 * b ) );
+        }
+
+        return result / 6;
+    }
+
+    template <typename T>
+    T centroid( const Cuts<T> &cuts )
+    {
+        // Area is the integral of widths of alpha cuts, moment the integral of ( upper^2 - lower^2 ) / 2, whose
+        // integrand is quadratic between alpha levels.
+        T area = T( 0 );
+        T moment = T( 0 );
+
+        for ( size_t k = 0; k < cuts.last(); ++k )
+        {
+            T height = cuts.alphas[k + 1] - cuts.alphas[k];
+            const T &l0 = cuts.lower[k];
+            const T &l1 = cuts.lower[k + 1];
+            const T &u0 = cuts.upper[k];
+            const T &u1 = cuts.upper[k + 1];
+
+            area += height * ( u0 + u1 - l0 - l1 );
+            moment += height * ( u0 * u0 + u0 * u1 + u1 * u1 - l0 * l0 - l0 * l1 - l1 * l1 );
+        }
+
+        if ( area == T( 0 ) )
+        {
+            return mean_of_maxima( cuts );
+        }
+
+        // Area is twice the true one and moment six times, so the ratio is divided by 3.
+        return moment / ( 3 * area );
+    }
+
+    // Distance from the start of a segment, where membership starts at level and grows with slope, that encloses area.
+    template <typename T>
+    T distance_for_area( const T &level, const T &slope, const T &area )
+    {
+        using boost::multiprecision::sqrt;
+        using std::sqrt;
+
+        // Root of slope / 2 * t^2 + level * t - area = 0, in a form without cancellation that also covers zero slope.
+        T denominator = level + sqrt( T( level * level + 2 * slope * area ) );
+
+        return denominator == T( 0 ) ? T( 0 ) : T( 2 * area / denominator );
+    }
+
+    template <typename T>
+    T bisector( const Cuts<T> &cuts )
+    {
+        size_t last = cuts.last();
+
+        // Areas under the rising branch, the kernel and the falling branch.
+        T left_area = T( 0 );
+        T right_area = T( 0 );
+
+        for ( size_t k = 0; k < last; ++k )
+        {
+            T levels = cuts.alphas[k] + cuts.alphas[k + 1];
+            left_area += ( cuts.lower[k + 1] - cuts.lower[k] ) * levels;
+            right_area += ( cuts.upper[k] - cuts.upper[k + 1] ) * levels;
+        }
+
+        left_area /= 2;
+        right_area /= 2;
+
+        T kernel_width = cuts.upper[last] - cuts.lower[last];
+        T half = ( left_area + kernel_width + right_area ) / 2;
+
+        if ( half == T( 0 ) )
+        {
+            return mean_of_maxima( cuts );
+        }
+
+        if ( half <= left_area )
+        {
+            T remaining = half;
+
+            for ( size_t k = 0; k < last; ++k )
+            {
+                T width = cuts.lower[k + 1] - cuts.lower[k];
+                T area = width * ( cuts.alphas[k] + cuts.alphas[k + 1] ) / 2;
+
+                if ( width > T( 0 ) && remaining <= area )
+                {
+                    T slope = ( cuts.alphas[k + 1] - cuts.alphas[k] ) / width;
+                    return cuts.lower[k] + distance_for_area( cuts.alphas[k], slope, remaining );
+                }
+
+                remaining -= area;
+            }
+
+            return cuts.lower[last];
+        }
+
+        if ( half <= left_area + kernel_width )
+        {
+            return cuts.lower[last] + ( half - left_area );
+        }
+
+        // Half of the area lies right of the bisector, measured from the end of support.
+        T remaining = half;
+
+        for ( size_t k = 0; k < last; ++k )
+        {
+            T width = cuts.upper[k] - cuts.upper[k + 1];
+            T area = width * ( cuts.alphas[k] + cuts.alphas[k + 1] ) / 2;
+
+            if ( width > T( 0 ) && remaining <= area )
+            {
+                T slope = ( cuts.alphas[k + 1] - cuts.alphas[k] ) / width;
+                return cuts.upper[k] - distance_for_area( cuts.alphas[k], slope, remaining );
+            }
+
+            remaining -= area;
+        }
+
+        return cuts.upper[last];
+    }
+
+    template <typename T>
+    T defuzzify( const Cuts<T> &cuts, DefuzzificationMethod method )
+    {
+        switch ( method )
+        {
+        case DefuzzificationMethod::Centroid:
+            return centroid( cuts );
+        case DefuzzificationMethod::Bisector:
+            return bisector( cuts );
+        case DefuzzificationMethod::MeanOfMaxima:
+            return mean_of_maxima( cuts );
+        case DefuzzificationMethod::ExpectedValue:
+            return expected_value( cuts );
+        case DefuzzificationMethod::GradedMean:
+            return graded_mean( cuts );
+        }
+
+        throw std::invalid_argument( "Unknown defuzzification method." );
+    }
+} // namespace
+
+template <typename T>
+T BasicDefuzzifier<T>::centroid( const BasicFuzzyNumber<T> &number ) { return ::centroid( cuts_of( number ) ); }
+
+template <typename T>
+T BasicDefuzzifier<T>::bisector( const BasicFuzzyNumber<T> &number ) { return ::bisector( cuts_of( number ) ); }
+
+template <typename T>
+T BasicDefuzzifier<T>::mean_of_maxima( const BasicFuzzyNumber<T> &number )
+{
+    return ::mean_of_maxima( cuts_of( number ) );
+}
+
+template <typename T>
+BasicInterval<T> BasicDefuzzifier<T>::expected_interval( const BasicFuzzyNumber<T> &number )
+{
+    return ::expected_interval( cuts_of( number ) );
+}
+
+template <typename T>
+T BasicDefuzzifier<T>::expected_value( const BasicFuzzyNumber<T> &number )
+{
+    return ::expected_value( cuts_of( number ) );
+}
+
+template <typename T>
+T BasicDefuzzifier<T>::graded_mean( const BasicFuzzyNumber<T> &number ) { return ::graded_mean( cuts_of( number ) ); }
+
+template <typename T>
+T BasicDefuzzifier<T>::defuzzify( const BasicFuzzyNumber<T> &number, DefuzzificationMethod method )
+{
+    return ::defuzzify( cuts_of( number ), method );
+}
+
+template <typename T>
+std::vector<T> BasicDefuzzifier<T>::defuzzify( std::span<const BasicFuzzyNumber<T>> numbers,
+                                               DefuzzificationMethod method )
+{
+    std::vector<T> values;
+    values.reserve( numbers.size() );
+
+    for ( const BasicFuzzyNumber<T> &number : numbers )
+    {
+        values.push_back( ::defuzzify( cuts_of( number ), method ) );
+    }
+
+    return values;
+}
+
+template <typename T>
+std::vector<T> BasicDefuzzifier<T>::defuzzify_batch( const BasicFuzzyNumberBatch<T> &batch,
+                                                     DefuzzificationMethod method )
+{
+    std::vector<T> values;
+    values.reserve( batch.size() );
+
+    for ( size_t index = 0; index < batch.size(); ++index )
+    {
+        Cuts<T> cuts{ batch.alpha_levels(), batch.lower_bounds( index ), batch.upper_bounds( index ) };
+        values.push_back( ::defuzzify( cuts, method ) );
+    }
+
+    return values;
+}
+
+template class DLL_API FuzzyMath::BasicDefuzzifier<PreciseFloat>;
+template class DLL_API FuzzyMath::BasicDefuzzifier<double>;
+template class DLL_API FuzzyMath::BasicDefuzzifier<long double>;
+#ifdef FUZZYMATH_HAS_FLOAT128
+template class DLL_API FuzzyMath::BasicDefuzzifier<QuadFloat>;
+#endif
@@ -0,0 +1,206 @@
+#include <algorithm>
+#include <future>
+#include <memory_resource>
+#include <thread>
+
+#include "FuzzyComparison.h"
+#include "MemoryResource.h"
+
+using namespace FuzzyMath;
+
+namespace
+{
+    // Lower or upper bounds of fuzzy number as a function of level beta, taken at alpha = beta, or at alpha = 1 - beta
+    // if reversed. Breakpoints are indexed in ascending order of beta, from 0 to 1.
+    template <typename T>
+    class Branch
+    {
+      public:
+        Branch( std::span<const T> alphas, std::span<const T> bounds, bool reversed )
+            : m_alphas( alphas ), m_bounds( bounds ), m_reversed( reversed )
+        {
+        }
+
+        size_t size() const { return m_alphas.size(); }
+
+        T level( size_t k ) const { return m_reversed ? T( 1 ) - m_alphas[size() - 1 - k] : m_alphas[k]; }
+
+        const T &bound( size_t k ) const { return m_reversed ? m_bounds[size() - 1 - k] : m_bounds[k]; }
+
+        // Value at beta, which must lie in ( level( k - 1 ), level( k ) ].
+        T at( size_t k, const T &beta ) const
+        {
+            T next = level( k );
+
+            if ( beta == next )
+                return bound( k );
+
+            T previous = level( k - 1 );
+            T t = ( beta - previous ) / ( next - previous );
+            return bound( k - 1 ) + t * ( bound( k ) - bound( k - 1 ) );
+        }
+
+      private:
+        std::span<const T> m_alphas;
+        std::span<const T> m_bounds;
+        bool m_reversed;
+    };
+
+    // Supremum of beta in [0, 1] with p( beta ) >= q( beta ), or p( beta ) > q( beta ) if strict. p is non-increasing
+    // and q non-decreasing, so the condition holds on an initial segment of [0, 1] and its end is found in one merged
+    // pass over breakpoints of both branches. Zero if the condition does not hold at all.
+    template <typename T>
+    T supremum_level( const Branch<T> &p, const Branch<T> &q, bool strict )
+    {
+        auto holds = [strict]( const T &difference ) { return strict ? difference > T( 0 ) : difference >= T( 0 ); };
+
+        T previous_beta = T( 0 );
+        T previous_difference = T( 0 );
+
+        // Both branches start at beta 0 and end at beta 1, so they are exhausted together.
+        for ( size_t i = 0, j = 0; i < p.size() && j < q.size(); )
+        {
+            T beta = std::min( p.level( i ), q.level( j ) );
+            T difference = p.at( i, beta ) - q.at( j, beta );
+
+            if ( !holds( difference ) )
+            {
+                if ( i == 0 && j == 0 )
+                    return T( 0 );
+
+                // Both branches are linear between the previous breakpoint and this one.
+                T root = previous_beta +
+                         previous_difference / ( previous_difference - difference ) * ( beta - previous_beta );
+                return std::min<T>( root, beta );
+            }
+
+            if ( p.level( i ) == beta )
+                ++i;
+            if ( q.level( j ) == beta )
+                ++j;
+
+            previous_beta = beta;
+            previous_difference = difference;
+        }
+
+        return T( 1 );
+    }
+
+    template <typename T>
+    PossibilisticMembership to_membership( const T &possibility, const T &necessity )
+    {
+        return PossibilisticMembership( PreciseFloat( possibility ), PreciseFloat( necessity ) );
+    }
+} // namespace
+
+template <typename T>
+PossibilisticMembership BasicFuzzyComparison<T>::greater_or_equal( const BasicFuzzyNumber<T> &a,
+                                                                   const BasicFuzzyNumber<T> &b )
+{
+    Branch<T> a_lower( a.alpha_levels(), a.lower_bounds(), false );
+    Branch<T> a_upper( a.alpha_levels(), a.upper_bounds(), false );
+
+    // PD: a reaches up to the lower bound of b. ND: one minus the level at which a can still lie below all of b.
+    T possibility = supremum_level( a_upper, Branch<T>( b.alpha_levels(), b.lower_bounds(), false ), false );
+    T necessity = T( 1 ) - supremum_level( Branch<T>( b.alpha_levels(), b.lower_bounds(), true ), a_lower, true );
+
+    return to_membership( possibility, necessity );
+}
+
+template <typename T>
+PossibilisticMembership BasicFuzzyComparison<T>::greater( const BasicFuzzyNumber<T> &a, const BasicFuzzyNumber<T> &b )
+{
+    Branch<T> a_lower( a.alpha_levels(), a.lower_bounds(), false );
+    Branch<T> a_upper( a.alpha_levels(), a.upper_bounds(), false );
+
+    // PSD: a exceeds b at its upper bound. NSD: one minus the level at which a can still lie below some of b.
+    T possibility = supremum_level( a_upper, Branch<T>( b.alpha_levels(), b.upper_bounds(), true ), true );
+    T necessity = T( 1 ) - supremum_level( Branch<T>( b.alpha_levels(), b.upper_bounds(), false ), a_lower, false );
+
+    return to_membership( possibility, necessity );
+}
+
+template <typename T>
+PossibilisticMembership BasicFuzzyComparison<T>::compare( const BasicFuzzyNumber<T> &a, const BasicFuzzyNumber<T> &b,
+                                                          Dominance relation )
+{
+    return relation == Dominance::Greater ? greater( a, b ) : greater_or_equal( a, b );
+}
+
+template <typename T>
+std::vector<PossibilisticMembership>
+BasicFuzzyComparison<T>::dominance_matrix( std::span<const BasicFuzzyNumber<T>> numbers, Dominance relation,
+                                           size_t number_of_threads )
+{
+    size_t count = numbers.size();
+    std::vector<PossibilisticMembership> matrix( count * count );
+
+    if ( count == 0 )
+        return matrix;
+
+    // Supports are gathered once, so disjoint pairs are decided from two contiguous columns.
+    std::pmr::vector<T> minima( memory_resource() );
+    std::pmr::vector<T> maxima( memory_resource() );
+    minima.reserve( count );
+    maxima.reserve( count );
+
+    for ( const BasicFuzzyNumber<T> &number : numbers )
+    {
+        minima.push_back( number.min() );
+        maxima.push_back( number.max() );
+    }
+
+    const PossibilisticMembership certain = to_membership( T( 1 ), T( 1 ) );
+
+    // Rows are written by one thread each. Default constructed elements are the impossible dominance.
+    auto fill_rows = [&]( size_t first, size_t last )
+    {
+        for ( size_t row = first; row < last; ++row )
+        {
+            for ( size_t column = 0; column < count; ++column )
+            {
+                if ( maxima[column] < minima[row] )
+                    matrix[row * count + column] = certain;
+                else if ( !( maxima[row] < minima[column] ) )
+                    matrix[row * count + column] = compare( numbers[row], numbers[column], relation );
+            }
+        }
+    };
+
+    if ( number_of_threads == 0 )
+    {
+        number_of_threads = std::max( std::thread::hardware_concurrency(), 1u );
+    }
+
+    size_t number_chunks = std::min( number_of_threads, count );
+    size_t chunk_size = count / number_chunks;
+    size_t remainder = count % number_chunks;
+
+    auto chunk_start = [chunk_size, remainder]( size_t chunk )
+    { return chunk * chunk_size + std::min( chunk, remainder ); };
+
+    // First block of rows is computed on the calling thread, others asynchronously.
+    std::pmr::vector<std::future<void>> chunks( memory_resource() );
+    chunks.reserve( number_chunks - 1 );
+
+    for ( size_t chunk = 1; chunk < number_chunks; ++chunk )
+    {
+        chunks.push_back( std::async( std::launch::async, fill_rows, chunk_start( chunk ), chunk_start( chunk + 1 ) ) );
+    }
+
+    fill_rows( 0, chunk_start( 1 ) );
+
+    for ( std::future<void> &chunk : chunks )
+    {
+        chunk.get();
+    }
+
+    return matrix;
+}
+
+template class DLL_API FuzzyMath::BasicFuzzyComparison<PreciseFloat>;
+template class DLL_API FuzzyMath::BasicFuzzyComparison<double>;
+template class DLL_API FuzzyMath::BasicFuzzyComparison<long double>;
+#ifdef FUZZYMATH_HAS_FLOAT128
+template class DLL_API FuzzyMath::BasicFuzzyComparison<QuadFloat>;
+#endif
@@ -0,0 +1,172 @@
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include "FuzzyDistance.h"
+
+using namespace FuzzyMath;
+
+namespace
+{
+    // Cursor over alpha levels of a fuzzy number, giving bounds at non-decreasing alpha.
+    template <typename T>
+    class LevelCursor
+    {
+      public:
+        explicit LevelCursor( const BasicFuzzyNumber<T> &number )
+            : m_alphas( number.alpha_levels() ), m_lower( number.lower_bounds() ), m_upper( number.upper_bounds() )
+        {
+        }
+
+        // Next alpha level not yet visited.
+        const T &next() const { return m_alphas[m_index]; }
+        bool done() const { return m_index == m_alphas.size(); }
+
+        // Bounds at alpha, which must not be above next(). Moves past next() if alpha is exactly at it.
+        void bounds( const T &alpha, T &lower, T &upper )
+        {
+            if ( m_alphas[m_index] == alpha )
+            {
+                lower = m_lower[m_index];
+                upper = m_upper[m_index];
+                ++m_index;
+                return;
+            }
+
+            T t = ( alpha - m_alphas[m_index - 1] ) / ( m_alphas[m_index] - m_alphas[m_index - 1] );
+            lower = m_lower[m_index - 1] + t * ( m_lower[m_index] - m_lower[m_index - 1] );
+            upper = m_upper[m_index - 1] + t * ( m_upper[m_index] - m_upper[m_index - 1] );
+        }
+
+      private:
+        std::span<const T> m_alphas;
+        std::span<const T> m_lower;
+        std::span<const T> m_upper;
+        size_t m_index = 0;
+    };
+
+    // Calls visit( alpha, lower difference, upper difference ) at every alpha level of a or b in ascending order.
+    template <typename T, typename V>
+    void for_each_merged_level( const BasicFuzzyNumber<T> &a, const BasicFuzzyNumber<T> &b, V &&visit )
+    {
+        LevelCursor<T> cursor_a( a );
+        LevelCursor<T> cursor_b( b );
+
+        T lower_a, upper_a, lower_b, upper_b;
+
+        // Both numbers end with alpha level 1, so cursors are exhausted together.
+        while ( !cursor_a.done() )
+        {
+            T alpha = std::min( cursor_a.next(), cursor_b.next() );
+            cursor_a.bounds( alpha, lower_a, upper_a );
+            cursor_b.bounds( alpha, lower_b, upper_b );
+            visit( alpha, T( lower_a - lower_b ), T( upper_a - upper_b ) );
+        }
+    }
+
+    // Integral of f * g over a segment of alpha of unit length, for f and g linear on it, times 6.
+    template <typename T>
+    T product_integral( const T &f0, const T &f1, const T &g0, const T &g1 )
+    {
+        return 2 * f0 * g0 + f0 * g1 + f1 * g0 + 2 * f1 * g1;
+    }
+
+    // Square root of the integral over alpha of the quadratic form
+    //     lower_weight * dl^2 + mixed_weight * dl * du + upper_weight * du^2
+    // of differences of bounds, exact for differences linear between merged alpha levels.
+    template <typename T>
+    T quadratic_distance( const BasicFuzzyNumber<T> &a, const BasicFuzzyNumber<T> &b, const T &lower_weight,
+                          const T &mixed_weight, const T &upper_weight )
+    {
+        using boost::multiprecision::sqrt;
+        using std::sqrt;
+
+        T sum = T( 0 );
+        T previous_alpha = T( 0 );
+        T previous_lower = T( 0 );
+        T previous_upper = T( 0 );
+        bool first = true;
+
+        auto accumulate = [&]( const T &alpha, const T &lower, const T &upper )
+        {
+            if ( !first )
+            {
+                T lower_terms = product_integral( previous_lower, lower, previous_lower, lower );
+                T mixed_terms = product_integral( previous_lower, lower, previous_upper, upper );
+                T upper_terms = product_integral( previous_upper, upper, previous_upper, upper );
+
+                sum += ( alpha - previous_alpha ) *
+                       ( lower_weight * lower_terms + mixed_weight * mixed_terms + upper_weight * upper_terms );
+            }
+
+            first = false;
+            previous_alpha = alpha;
+            previous_lower = lower;
+            previous_upper = upper;
+        };
+
+        for_each_merged_level( a, b, accumulate );
+
+        // Rounding can leave a tiny negative sum for equal numbers.
+        return sum > T( 0 ) ? T( sqrt( T( sum / 6 ) ) ) : T( 0 );
+    }
+} // namespace
+
+template <typename T>
+T BasicFuzzyDistance<T>::hausdorff( const BasicFuzzyNumber<T> &a, const BasicFuzzyNumber<T> &b )
+{
+    // Differences are linear between merged alpha levels, so the supremum is attained at one of them.
+    T result = T( 0 );
+
+    auto absolute = []( const T &value ) { return value < T( 0 ) ? T( -value ) : value; };
+
+    for_each_merged_level( a, b, [&]( const T &, const T &lower, const T &upper )
+                           { result = std::max( { result, absolute( lower ), absolute( upper ) } ); } );
+
+    return result;
+}
+
+template <typename T>
+T BasicFuzzyDistance<T>::l2( const BasicFuzzyNumber<T> &a, const BasicFuzzyNumber<T> &b )
+{
+    return quadratic_distance( a, b, T( 1 ), T( 0 ), T( 1 ) );
+}
+
+template <typename T>
+T BasicFuzzyDistance<T>::bertoluzza( const BasicFuzzyNumber<T> &a, const BasicFuzzyNumber<T> &b, const T &theta )
+{
+    if ( theta <= T( 0 ) )
+    {
+        throw std::invalid_argument( "Theta of Bertoluzza distance must be positive." );
+    }
+
+    // Differences of midpoint ( dl + du ) / 2 and spread ( du - dl ) / 2 expanded in differences of bounds.
+    T outer_weight = ( 1 + theta ) / 4;
+    T mixed_weight = ( 1 - theta ) / 2;
+
+    return quadratic_distance( a, b, outer_weight, mixed_weight, outer_weight );
+}
+
+template <typename T>
+T BasicFuzzyDistance<T>::distance( const BasicFuzzyNumber<T> &a, const BasicFuzzyNumber<T> &b,
+                                   DistanceMetric metric )
+{
+    switch ( metric )
+    {
+    case DistanceMetric::Hausdorff:
+        return hausdorff( a, b );
+    case DistanceMetric::L2:
+        return l2( a, b );
+    case DistanceMetric::Bertoluzza:
+        return bertoluzza( a, b );
+    }
+
+    throw std::invalid_argument( "Unknown distance metric." );
+}
+
+template class DLL_API FuzzyMath::BasicFuzzyDistance<PreciseFloat>;
+template class DLL_API FuzzyMath::BasicFuzzyDistance<double>;
+template class DLL_API FuzzyMath::BasicFuzzyDistance<long double>;
+#ifdef FUZZYMATH_HAS_FLOAT128
+template class DLL_API FuzzyMath::BasicFuzzyDistance<QuadFloat>;
+#endif
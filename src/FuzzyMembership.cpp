@@ -4,7 +4,9 @@ using namespace FuzzyMath;
 
 FuzzyMembership::FuzzyMembership( std::string v ) : FuzzyMembership( PreciseFloat( v ) ) {}
 
-FuzzyMembership::FuzzyMembership( PreciseFloat v )
+FuzzyMembership::FuzzyMembership() = default;
+
+FuzzyMembership::FuzzyMembership( PreciseFloat v ) : value( v )
 {
     if ( v < 0.0 || v > 1.0 )
         throw std::out_of_range( "Membership value must be in [0, 1]" );
@@ -1,5 +1,7 @@
 #include <algorithm>
 #include <iterator>
+#include <numeric>
+#include <optional>
 #include <set>
 #include <stdexcept>
 
@@ -9,217 +11,510 @@
 
 using namespace FuzzyMath;
 
-FuzzyNumber::FuzzyNumber( const std::set<AlphaCut> &alpha_cuts )
+namespace
 {
-    if ( alpha_cuts.size() < 2 )
+    template <typename T>
+    std::optional<T> &auto_simplify_tolerance()
+    {
+        thread_local std::optional<T> tolerance;
+        return tolerance;
+    }
+} // namespace
+
+template <typename T>
+BasicFuzzyNumber<T>::BasicFuzzyNumber( const std::set<BasicAlphaCut<T>> &alpha_cuts )
+    : m_alphas( memory_resource() ), m_lower( memory_resource() ), m_upper( memory_resource() )
+{
+    FUZZYMATH_TIME( Construction );
+    FUZZYMATH_COUNT( FuzzyNumbers, 1 );
+
+    m_alphas.reserve( alpha_cuts.size() );
+    m_lower.reserve( alpha_cuts.size() );
+    m_upper.reserve( alpha_cuts.size() );
+
+    for ( const BasicAlphaCut<T> &cut : alpha_cuts )
+    {
+        BasicInterval<T> interval = cut.interval();
+        m_alphas.push_back( cut.alpha() );
+        m_lower.push_back( interval.min() );
+        m_upper.push_back( interval.max() );
+    }
+
+    validate();
+}
+
+template <typename T>
+BasicFuzzyNumber<T>::BasicFuzzyNumber( storage_type alphas, storage_type lower, storage_type upper )
+    : m_alphas( std::move( alphas ), memory_resource() ), m_lower( std::move( lower ), memory_resource() ),
+      m_upper( std::move( upper ), memory_resource() )
+{
+    FUZZYMATH_TIME( Construction );
+    FUZZYMATH_COUNT( FuzzyNumbers, 1 );
+
+    validate();
+}
+
+template <typename T>
+BasicFuzzyNumber<T>::BasicFuzzyNumber( AlreadyValidated, storage_type alphas, storage_type lower, storage_type upper )
+    : m_alphas( std::move( alphas ), memory_resource() ), m_lower( std::move( lower ), memory_resource() ),
+      m_upper( std::move( upper ), memory_resource() )
+{
+    FUZZYMATH_COUNT( FuzzyNumbers, 1 );
+}
+
+template <typename T>
+void BasicFuzzyNumber<T>::validate() const
+{
+#ifndef FUZZYMATH_NO_VALIDATION
+    FUZZYMATH_COUNT( Validations, 1 );
+
+    if ( m_lower.size() != m_alphas.size() || m_upper.size() != m_alphas.size() )
+    {
+        throw std::invalid_argument( "FuzzyNumber must have the same number of alpha values and bounds" );
+    }
+
+    if ( m_alphas.size() < 2 )
     {
         throw std::invalid_argument( "FuzzyNumber must have at least two alpha cuts" );
     }
 
-    if ( alpha_cuts.begin()->alpha() != PreciseFloat( 0 ) )
+    if ( m_alphas.front() != T( 0 ) )
     {
         throw std::invalid_argument( "FuzzyNumber must start with alpha cut 0" );
     }
 
-    if ( std::prev( alpha_cuts.end() )->alpha() != PreciseFloat( 1 ) )
+    if ( m_alphas.back() != T( 1 ) )
     {
         throw std::invalid_argument( "FuzzyNumber must end with alpha cut 1" );
     }
 
-    AlphaCut previous = *alpha_cuts.begin();
-
-    for ( const AlphaCut current : alpha_cuts )
+    for ( size_t i = 1; i < m_alphas.size(); ++i )
     {
-        if ( current.alpha() == PreciseFloat( 0 ) )
+        if ( !( m_alphas[i - 1] < m_alphas[i] ) )
         {
-            continue;
+            throw std::invalid_argument( "Alpha values must be strictly increasing" );
         }
 
-        if ( !previous.contains( current ) )
+        if ( !( m_lower[i] <= m_upper[i] ) )
+        {
+            throw std::invalid_argument( "Lower bound of alpha cut must not be greater than upper bound" );
+        }
+
+        if ( !( m_lower[0] <= m_lower[i] && m_upper[i] <= m_upper[0] ) )
         {
             throw std::invalid_argument( "Alpha cut intervals must be nested" );
         }
     }
+#endif
+}
 
-    m_alpha_cuts = alpha_cuts;
+template <typename T>
+size_t BasicFuzzyNumber<T>::size() const { return m_alphas.size(); }
+
+template <typename T>
+BasicAlphaCut<T> BasicFuzzyNumber<T>::cut_at( size_t index ) const
+{
+    return BasicAlphaCut<T>( m_alphas[index], BasicInterval<T>( m_lower[index], m_upper[index] ) );
 }
 
-size_t FuzzyNumber::size() const { return m_alpha_cuts.size(); }
+template <typename T>
+typename BasicFuzzyNumber<T>::const_iterator BasicFuzzyNumber<T>::begin() const
+{
+    return const_iterator( this, 0 );
+}
 
-const AlphaCut FuzzyNumber::alpha_cut( const PreciseFloat &alpha ) const
+template <typename T>
+typename BasicFuzzyNumber<T>::const_iterator BasicFuzzyNumber<T>::end() const
 {
-    if ( alpha < PreciseFloat( 0 ) || alpha > PreciseFloat( 1 ) )
+    return const_iterator( this, m_alphas.size() );
+}
+
+template <typename T>
+std::span<const T> BasicFuzzyNumber<T>::alpha_levels() const { return m_alphas; }
+
+template <typename T>
+std::span<const T> BasicFuzzyNumber<T>::lower_bounds() const { return m_lower; }
+
+template <typename T>
+std::span<const T> BasicFuzzyNumber<T>::upper_bounds() const { return m_upper; }
+
+template <typename T>
+const BasicAlphaCut<T> BasicFuzzyNumber<T>::alpha_cut( const T &alpha ) const
+{
+    FUZZYMATH_TIME( AlphaCut );
+
+    if ( alpha < T( 0 ) || alpha > T( 1 ) )
     {
         throw std::out_of_range( "alpha must be in the range [0, 1]" );
     }
 
-    auto it = m_alpha_cuts.find( AlphaCut( alpha ) );
-    if ( it != m_alpha_cuts.end() )
+    size_t upper = std::lower_bound( m_alphas.begin(), m_alphas.end(), alpha ) - m_alphas.begin();
+
+    return BasicAlphaCut<T>( alpha, interpolate( upper, alpha ) );
+}
+
+template <typename T>
+BasicInterval<T> BasicFuzzyNumber<T>::interpolate( size_t upper, const T &alpha ) const
+{
+    if ( m_alphas[upper] == alpha )
     {
-        return *it;
+        return BasicInterval<T>( m_lower[upper], m_upper[upper] );
     }
 
-    auto upper = m_alpha_cuts.lower_bound( AlphaCut( alpha ) );
-    auto lower = std::prev( upper );
+    FUZZYMATH_COUNT( Interpolations, 1 );
 
-    PreciseFloat t = ( alpha - lower->alpha() ) / ( upper->alpha() - lower->alpha() );
+    size_t lower = upper - 1;
 
-    PreciseFloat min_value = lower->interval().min() + t * ( upper->interval().min() - lower->interval().min() );
-    PreciseFloat max_value = lower->interval().max() + t * ( upper->interval().max() - lower->interval().max() );
+    T t = ( alpha - m_alphas[lower] ) / ( m_alphas[upper] - m_alphas[lower] );
 
-    return AlphaCut( alpha, Interval( min_value, max_value ) );
-}
+    T min_value = m_lower[lower] + t * ( m_lower[upper] - m_lower[lower] );
+    T max_value = m_upper[lower] + t * ( m_upper[upper] - m_upper[lower] );
 
-PreciseFloat FuzzyNumber::min() const { return m_alpha_cuts.begin()->interval().min(); }
+    return BasicInterval<T>( min_value, max_value );
+}
 
-PreciseFloat FuzzyNumber::max() const { return m_alpha_cuts.begin()->interval().max(); }
+template <typename T>
+BasicFuzzyNumber<T> BasicFuzzyNumber<T>::simplify( const T &tolerance ) const
+{
+    if ( tolerance < T( 0 ) )
+    {
+        throw std::invalid_argument( "Tolerance of simplification must not be negative" );
+    }
 
-Interval FuzzyNumber::support() const { return m_alpha_cuts.begin()->interval(); }
+    BasicFuzzyNumber number( already_validated, storage_type( m_alphas, memory_resource() ),
+                             storage_type( m_lower, memory_resource() ), storage_type( m_upper, memory_resource() ) );
+    number.drop_interpolable_cuts( tolerance );
+    return number;
+}
 
-Interval FuzzyNumber::kernel() const { return std::prev( m_alpha_cuts.end() )->interval(); }
+template <typename T>
+void BasicFuzzyNumber<T>::set_auto_simplify( std::optional<T> tolerance )
+{
+    if ( tolerance && *tolerance < T( 0 ) )
+    {
+        throw std::invalid_argument( "Tolerance of simplification must not be negative" );
+    }
 
-PreciseFloat FuzzyNumber::kernel_min() const { return kernel().min(); }
+    auto_simplify_tolerance<T>() = std::move( tolerance );
+}
 
-PreciseFloat FuzzyNumber::kernel_max() const { return kernel().max(); }
+template <typename T>
+std::optional<T> BasicFuzzyNumber<T>::auto_simplify() { return auto_simplify_tolerance<T>(); }
 
-std::vector<PreciseFloat> FuzzyNumber::alpha_cut_values( size_t number_of_cuts )
+template <typename T>
+void BasicFuzzyNumber<T>::simplify_automatically()
 {
-    std::vector<PreciseFloat> alphas;
-
-    size_t i = 0;
+    const std::optional<T> &tolerance = auto_simplify_tolerance<T>();
 
-    while ( i <= number_of_cuts - 1 )
+    if ( tolerance )
     {
-        alphas.push_back( PreciseFloat( i ) / ( number_of_cuts - 1 ) );
-        i += 1;
+        drop_interpolable_cuts( *tolerance );
     }
-    return alphas;
 }
 
-std::vector<PreciseFloat> FuzzyNumber::alphas() const
+template <typename T>
+void BasicFuzzyNumber<T>::drop_interpolable_cuts( const T &tolerance )
 {
-    std::vector<PreciseFloat> alphas;
-    alphas.reserve( m_alpha_cuts.size() );
-    for ( const AlphaCut &cut : m_alpha_cuts )
+    if ( size() <= 2 )
+        return;
+
+    auto distance = []( const T &a, const T &b ) { return a < b ? b - a : a - b; };
+
+    std::pmr::vector<bool> keep( size(), false, memory_resource() );
+    keep.front() = true;
+    keep.back() = true;
+
+    // Ranges between two kept cuts are split at the cut farthest from interpolation between them, on either bound,
+    // until every cut in between is within tolerance.
+    std::pmr::vector<std::pair<size_t, size_t>> ranges( memory_resource() );
+    ranges.emplace_back( 0, size() - 1 );
+
+    while ( !ranges.empty() )
     {
-        alphas.push_back( cut.alpha() );
+        auto [first, last] = ranges.back();
+        ranges.pop_back();
+
+        T worst = tolerance;
+        size_t split = first;
+
+        for ( size_t i = first + 1; i < last; ++i )
+        {
+            T t = ( m_alphas[i] - m_alphas[first] ) / ( m_alphas[last] - m_alphas[first] );
+            T lower = m_lower[first] + t * ( m_lower[last] - m_lower[first] );
+            T upper = m_upper[first] + t * ( m_upper[last] - m_upper[first] );
+            T error = std::max( distance( m_lower[i], lower ), distance( m_upper[i], upper ) );
+
+            if ( error > worst )
+            {
+                worst = error;
+                split = i;
+            }
+        }
+
+        if ( split != first )
+        {
+            keep[split] = true;
+            ranges.emplace_back( first, split );
+            ranges.emplace_back( split, last );
+        }
     }
-    return alphas;
-}
 
-std::vector<PreciseFloat> FuzzyNumber::union_of_alpha_cuts( FuzzyNumber &other ) const
-{
-    std::vector<PreciseFloat> other_alphas = other.alphas();
+    // Subset of nested cuts is nested, so the columns are compacted without validation.
+    size_t kept = 0;
 
-    std::vector<PreciseFloat> merged_alphas = alphas();
-    merged_alphas.insert( merged_alphas.end(), other_alphas.begin(), other_alphas.end() );
+    for ( size_t i = 0; i < size(); ++i )
+    {
+        if ( keep[i] )
+        {
+            if ( kept != i )
+            {
+                m_alphas[kept] = std::move( m_alphas[i] );
+                m_lower[kept] = std::move( m_lower[i] );
+                m_upper[kept] = std::move( m_upper[i] );
+            }
+            ++kept;
+        }
+    }
 
-    std::sort( merged_alphas.begin(), merged_alphas.end() );
-    auto last = std::unique( merged_alphas.begin(), merged_alphas.end() );
-    merged_alphas.erase( last, merged_alphas.end() );
+    m_alphas.resize( kept );
+    m_lower.resize( kept );
+    m_upper.resize( kept );
+}
+
+template <typename T>
+FuzzyMembership BasicFuzzyNumber<T>::membership( const T &value ) const
+{
+    size_t left = std::upper_bound( m_lower.begin(), m_lower.end(), value ) - m_lower.begin();
+    size_t right = std::partition_point( m_upper.begin(), m_upper.end(),
+                                         [&value]( const T &bound ) { return !( bound < value ); } ) -
+                   m_upper.begin();
 
-    return merged_alphas;
+    return FuzzyMembership( PreciseFloat( membership_level( left, right, value ) ) );
 }
 
-FuzzyNumber FuzzyNumber::operation( const FuzzyNumber &other,
-                                    const std::function<AlphaCut( const AlphaCut &, const AlphaCut & )> &op ) const
+template <typename T>
+std::vector<FuzzyMembership> BasicFuzzyNumber<T>::membership( std::span<const T> values ) const
 {
-    std::vector<PreciseFloat> merged_alphas = union_of_alpha_cuts( const_cast<FuzzyNumber &>( other ) );
-    std::set<AlphaCut> alpha_cuts;
+    std::vector<FuzzyMembership> memberships( values.size() );
+
+    // Unsorted values are visited through a sorted permutation.
+    std::pmr::vector<size_t> order( memory_resource() );
+    bool sorted = std::is_sorted( values.begin(), values.end() );
 
-    for ( const PreciseFloat &alpha : merged_alphas )
+    if ( !sorted )
     {
-        alpha_cuts.insert( op( alpha_cut( alpha ), other.alpha_cut( alpha ) ) );
+        order.resize( values.size() );
+        std::iota( order.begin(), order.end(), size_t( 0 ) );
+        std::sort( order.begin(), order.end(), [&values]( size_t a, size_t b ) { return values[a] < values[b]; } );
     }
 
-    return FuzzyNumber( alpha_cuts );
+    // Both positions only move one way while values grow, lower bounds ascend and upper bounds descend with alpha.
+    size_t left = 0;
+    size_t right = size();
+
+    for ( size_t i = 0; i < values.size(); ++i )
+    {
+        size_t index = sorted ? i : order[i];
+        const T &value = values[index];
+
+        while ( left < size() && !( value < m_lower[left] ) )
+            ++left;
+
+        while ( right > 0 && m_upper[right - 1] < value )
+            --right;
+
+        memberships[index] = FuzzyMembership( PreciseFloat( membership_level( left, right, value ) ) );
+    }
+
+    return memberships;
 }
 
-FuzzyNumber FuzzyNumber::apply_function( const std::function<PreciseFloat( const PreciseFloat & )> &func, bool monotone,
-                                         size_t number_elements ) const
+template <typename T>
+T BasicFuzzyNumber<T>::membership_level( size_t left, size_t right, const T &value ) const
 {
-    std::set<AlphaCut> new_alpha_cuts;
+    // Outside of support.
+    if ( left == 0 || right == 0 )
+    {
+        return T( 0 );
+    }
 
-    PreciseFloat width = max() - min();
+    T left_alpha = T( 1 );
 
-    for ( const AlphaCut &cut : m_alpha_cuts )
+    if ( left < size() )
     {
-        size_t number_elements_cut = static_cast<size_t>( cut.interval().width() / width * number_elements );
+        T t = ( value - m_lower[left - 1] ) / ( m_lower[left] - m_lower[left - 1] );
+        left_alpha = std::min<T>( m_alphas[left - 1] + t * ( m_alphas[left] - m_alphas[left - 1] ), m_alphas[left] );
+    }
 
-        if ( number_elements_cut < 1 )
-        {
-            number_elements_cut = 1; // Ensure at least one element per cut
-        }
+    T right_alpha = T( 1 );
+
+    if ( right < size() )
+    {
+        T t = ( m_upper[right - 1] - value ) / ( m_upper[right - 1] - m_upper[right] );
+        right_alpha =
+            std::min<T>( m_alphas[right - 1] + t * ( m_alphas[right] - m_alphas[right - 1] ), m_alphas[right] );
+    }
+
+    return std::min( left_alpha, right_alpha );
+}
+
+template <typename T>
+T BasicFuzzyNumber<T>::min() const { return m_lower.front(); }
+
+template <typename T>
+T BasicFuzzyNumber<T>::max() const { return m_upper.front(); }
+
+template <typename T>
+BasicInterval<T> BasicFuzzyNumber<T>::support() const { return BasicInterval<T>( m_lower.front(), m_upper.front() ); }
 
-        new_alpha_cuts.insert( cut.apply_function( func, monotone, number_elements_cut ) );
+template <typename T>
+BasicInterval<T> BasicFuzzyNumber<T>::kernel() const { return BasicInterval<T>( m_lower.back(), m_upper.back() ); }
+
+template <typename T>
+T BasicFuzzyNumber<T>::kernel_min() const { return kernel().min(); }
+
+template <typename T>
+T BasicFuzzyNumber<T>::kernel_max() const { return kernel().max(); }
+
+template <typename T>
+std::vector<T> BasicFuzzyNumber<T>::alpha_cut_values( size_t number_of_cuts )
+{
+    std::vector<T> alphas;
+
+    size_t i = 0;
+
+    while ( i <= number_of_cuts - 1 )
+    {
+        alphas.push_back( T( i ) / T( number_of_cuts - 1 ) );
+        i += 1;
     }
+    return alphas;
+}
+
+template <typename T>
+std::vector<T> BasicFuzzyNumber<T>::alphas() const { return std::vector<T>( m_alphas.begin(), m_alphas.end() ); }
 
-    return FuzzyNumber( new_alpha_cuts );
+template <typename T>
+BasicFuzzyNumber<T> BasicFuzzyNumber<T>::apply_function( const std::function<T( const T & )> &func, bool monotone,
+                                                        size_t number_elements ) const
+{
+    return apply_function<const std::function<T( const T & )> &>( func, monotone, number_elements );
 }
 
-bool FuzzyNumber::operator==( const FuzzyNumber &other ) const
+template <typename T>
+bool BasicFuzzyNumber<T>::operator==( const BasicFuzzyNumber &other ) const
 {
-    if ( m_alpha_cuts.size() != other.m_alpha_cuts.size() )
+    if ( size() != other.size() )
         return false;
 
-    return m_alpha_cuts == other.m_alpha_cuts;
+    return m_alphas == other.m_alphas && m_lower == other.m_lower && m_upper == other.m_upper;
 }
 
-FuzzyNumber FuzzyNumber::operator-() const
+template <typename T>
+BasicFuzzyNumber<T> BasicFuzzyNumber<T>::operator-() const
 {
-    std::set<AlphaCut> alpha_cuts;
+    storage_type lower( memory_resource() );
+    storage_type upper( memory_resource() );
+    lower.reserve( size() );
+    upper.reserve( size() );
 
-    for ( const AlphaCut &cut : m_alpha_cuts )
+    for ( size_t i = 0; i < size(); ++i )
     {
-        alpha_cuts.insert( -cut );
+        lower.push_back( -m_upper[i] );
+        upper.push_back( -m_lower[i] );
     }
 
-    return FuzzyNumber( alpha_cuts );
+    return BasicFuzzyNumber( already_validated, storage_type( m_alphas, memory_resource() ), std::move( lower ),
+                             std::move( upper ) );
 }
 
-FuzzyNumber FuzzyNumber::operator+( const FuzzyNumber &other ) const
+template <typename T>
+BasicFuzzyNumber<T> &BasicFuzzyNumber<T>::operator+=( const T &value )
 {
-    return operation( other, []( const AlphaCut &a, const AlphaCut &b )
-                      { return AlphaCut( a.alpha(), a.interval() + b.interval() ); } );
+    for ( size_t i = 0; i < size(); ++i )
+    {
+        m_lower[i] += value;
+        m_upper[i] += value;
+    }
+
+    return *this;
 }
 
-FuzzyNumber FuzzyNumber::operator-( const FuzzyNumber &other ) const
+template <typename T>
+BasicFuzzyNumber<T> &BasicFuzzyNumber<T>::operator-=( const T &value )
 {
-    return operation( other, []( const AlphaCut &a, const AlphaCut &b )
-                      { return AlphaCut( a.alpha(), a.interval() - b.interval() ); } );
+    for ( size_t i = 0; i < size(); ++i )
+    {
+        m_lower[i] -= value;
+        m_upper[i] -= value;
+    }
+
+    return *this;
 }
 
-FuzzyNumber FuzzyNumber::operator*( const FuzzyNumber &other ) const
+template <typename T>
+BasicFuzzyNumber<T> &BasicFuzzyNumber<T>::operator*=( const T &value )
 {
-    return operation( other, []( const AlphaCut &a, const AlphaCut &b )
-                      { return AlphaCut( a.alpha(), a.interval() * b.interval() ); } );
+    for ( size_t i = 0; i < size(); ++i )
+    {
+        m_lower[i] *= value;
+        m_upper[i] *= value;
+    }
+
+    // Negative scale reverses the order of bounds.
+    if ( value < T( 0 ) )
+    {
+        m_lower.swap( m_upper );
+    }
+
+    return *this;
 }
 
-FuzzyNumber FuzzyNumber::operator/( const FuzzyNumber &other ) const
+template <typename T>
+BasicFuzzyNumber<T> &BasicFuzzyNumber<T>::operator/=( const T &value )
 {
-    if ( other.support().contains( PreciseFloat( 0 ) ) )
+    if ( value == T( 0 ) )
+    {
+        throw std::domain_error( "Division by zero." );
+    }
+
+    for ( size_t i = 0; i < size(); ++i )
     {
-        throw std::domain_error( "Division by FuzzyNumber containing zero." );
+        m_lower[i] /= value;
+        m_upper[i] /= value;
     }
 
-    return operation( other, []( const AlphaCut &a, const AlphaCut &b )
-                      { return AlphaCut( a.alpha(), a.interval() / b.interval() ); } );
+    if ( value < T( 0 ) )
+    {
+        m_lower.swap( m_upper );
+    }
+
+    return *this;
 }
 
-const std::string FuzzyNumber::to_string() const
+template <typename T>
+const std::string BasicFuzzyNumber<T>::to_string() const
 {
     std::ostringstream oss;
-    for ( const AlphaCut &cut : m_alpha_cuts )
+    for ( size_t i = 0; i < size(); ++i )
     {
-        oss << "(" << cut.alpha() << "; " << cut.interval().min() << ", " << cut.interval().max() << ") ";
+        oss << "(" << m_alphas[i] << "; " << m_lower[i] << ", " << m_upper[i] << ") ";
     }
     return oss.str();
 }
 
-const std::string FuzzyNumber::to_descriptive_string() const
+template <typename T>
+const std::string BasicFuzzyNumber<T>::to_descriptive_string() const
 {
     std::ostringstream oss;
     oss << "Fuzzy number with support (" << min() << ", " << max() << "), kernel (" << kernel_min() << ", "
         << kernel_max() << ") and " << size() - 2 << " more alpha-cuts.";
     return oss.str();
 }
+
+template class DLL_API FuzzyMath::BasicFuzzyNumber<PreciseFloat>;
+template class DLL_API FuzzyMath::BasicFuzzyNumber<double>;
+template class DLL_API FuzzyMath::BasicFuzzyNumber<long double>;
+#ifdef FUZZYMATH_HAS_FLOAT128
+template class DLL_API FuzzyMath::BasicFuzzyNumber<QuadFloat>;
+#endif
@@ -0,0 +1,288 @@
+#include <algorithm>
+#include <stdexcept>
+
+#include "FuzzyNumberBatch.h"
+
+using namespace FuzzyMath;
+
+template <typename T>
+BasicFuzzyNumberBatch<T>::BasicFuzzyNumberBatch( std::vector<T> alphas, std::vector<T> lower, std::vector<T> upper )
+    : m_alphas( std::move( alphas ) ), m_lower( std::move( lower ) ), m_upper( std::move( upper ) )
+{
+    validate();
+}
+
+template <typename T>
+BasicFuzzyNumberBatch<T>::BasicFuzzyNumberBatch( AlreadyValidated, std::vector<T> alphas, std::vector<T> lower,
+                                                 std::vector<T> upper )
+    : m_alphas( std::move( alphas ) ), m_lower( std::move( lower ) ), m_upper( std::move( upper ) )
+{
+}
+
+template <typename T>
+BasicFuzzyNumberBatch<T>::BasicFuzzyNumberBatch( const std::vector<BasicFuzzyNumber<T>> &numbers,
+                                                 std::vector<T> alphas )
+    : m_alphas( std::move( alphas ) )
+{
+    m_lower.reserve( numbers.size() * m_alphas.size() );
+    m_upper.reserve( numbers.size() * m_alphas.size() );
+
+    for ( const BasicFuzzyNumber<T> &number : numbers )
+    {
+        // Alphas are sorted, so the upper neighbouring cut of the number only moves forward.
+        size_t upper = 0;
+
+        for ( const T &alpha : m_alphas )
+        {
+            if ( alpha < T( 0 ) || alpha > T( 1 ) )
+            {
+                throw std::out_of_range( "alpha must be in the range [0, 1]" );
+            }
+
+            while ( number.m_alphas[upper] < alpha )
+            {
+                ++upper;
+            }
+
+            BasicInterval<T> interval = number.interpolate( upper, alpha );
+            m_lower.push_back( interval.min() );
+            m_upper.push_back( interval.max() );
+        }
+    }
+
+    validate();
+}
+
+template <typename T>
+BasicFuzzyNumberBatch<T>::BasicFuzzyNumberBatch( const std::vector<BasicFuzzyNumber<T>> &numbers,
+                                                 size_t number_of_cuts )
+    : BasicFuzzyNumberBatch( numbers, BasicFuzzyNumber<T>::alpha_cut_values( number_of_cuts ) )
+{
+}
+
+template <typename T>
+void BasicFuzzyNumberBatch<T>::validate() const
+{
+#ifndef FUZZYMATH_NO_VALIDATION
+    if ( m_alphas.size() < 2 )
+    {
+        throw std::invalid_argument( "FuzzyNumberBatch must have at least two alpha levels" );
+    }
+
+    if ( m_alphas.front() != T( 0 ) || m_alphas.back() != T( 1 ) )
+    {
+        throw std::invalid_argument( "FuzzyNumberBatch alpha levels must start with 0 and end with 1" );
+    }
+
+    if ( !std::is_sorted( m_alphas.begin(), m_alphas.end() ) ||
+         std::adjacent_find( m_alphas.begin(), m_alphas.end() ) != m_alphas.end() )
+    {
+        throw std::invalid_argument( "FuzzyNumberBatch alpha levels must be strictly increasing" );
+    }
+
+    if ( m_lower.size() != m_upper.size() || m_lower.size() % m_alphas.size() != 0 )
+    {
+        throw std::invalid_argument( "FuzzyNumberBatch bounds must be matrices with one column per alpha level" );
+    }
+
+    size_t cuts = number_of_cuts();
+
+    for ( size_t offset = 0; offset < m_lower.size(); offset += cuts )
+    {
+        for ( size_t i = offset; i < offset + cuts; ++i )
+        {
+            if ( !( m_lower[i] <= m_upper[i] ) )
+            {
+                throw std::invalid_argument( "Lower bound of alpha cut must not be greater than upper bound" );
+            }
+
+            if ( !( m_lower[offset] <= m_lower[i] && m_upper[i] <= m_upper[offset] ) )
+            {
+                throw std::invalid_argument( "Alpha cut intervals must be nested" );
+            }
+        }
+    }
+#endif
+}
+
+template <typename T>
+void BasicFuzzyNumberBatch<T>::check_compatible( const BasicFuzzyNumberBatch &other ) const
+{
+    if ( size() != other.size() )
+    {
+        throw std::invalid_argument( "FuzzyNumberBatch sizes do not match" );
+    }
+
+    if ( m_alphas != other.m_alphas )
+    {
+        throw std::invalid_argument( "FuzzyNumberBatch alpha levels do not match" );
+    }
+}
+
+template <typename T>
+size_t BasicFuzzyNumberBatch<T>::size() const { return m_lower.size() / m_alphas.size(); }
+
+template <typename T>
+size_t BasicFuzzyNumberBatch<T>::number_of_cuts() const { return m_alphas.size(); }
+
+template <typename T>
+std::span<const T> BasicFuzzyNumberBatch<T>::alpha_levels() const { return m_alphas; }
+
+template <typename T>
+std::span<const T> BasicFuzzyNumberBatch<T>::lower_bounds( size_t index ) const
+{
+    if ( index >= size() )
+    {
+        throw std::out_of_range( "FuzzyNumberBatch index out of range" );
+    }
+
+    return std::span<const T>( m_lower ).subspan( index * number_of_cuts(), number_of_cuts() );
+}
+
+template <typename T>
+std::span<const T> BasicFuzzyNumberBatch<T>::upper_bounds( size_t index ) const
+{
+    if ( index >= size() )
+    {
+        throw std::out_of_range( "FuzzyNumberBatch index out of range" );
+    }
+
+    return std::span<const T>( m_upper ).subspan( index * number_of_cuts(), number_of_cuts() );
+}
+
+template <typename T>
+BasicFuzzyNumber<T> BasicFuzzyNumberBatch<T>::fuzzy_number( size_t index ) const
+{
+    std::span<const T> lower = lower_bounds( index );
+    std::span<const T> upper = upper_bounds( index );
+
+    using storage_type = typename BasicFuzzyNumber<T>::storage_type;
+
+    return BasicFuzzyNumber<T>( already_validated, storage_type( m_alphas.begin(), m_alphas.end(), memory_resource() ),
+                                storage_type( lower.begin(), lower.end(), memory_resource() ),
+                                storage_type( upper.begin(), upper.end(), memory_resource() ) );
+}
+
+template <typename T>
+BasicFuzzyNumber<T> BasicFuzzyNumberBatch<T>::operator[]( size_t index ) const { return fuzzy_number( index ); }
+
+template <typename T>
+std::vector<BasicFuzzyNumber<T>> BasicFuzzyNumberBatch<T>::fuzzy_numbers() const
+{
+    std::vector<BasicFuzzyNumber<T>> numbers;
+    numbers.reserve( size() );
+
+    for ( size_t i = 0; i < size(); ++i )
+    {
+        numbers.push_back( fuzzy_number( i ) );
+    }
+
+    return numbers;
+}
+
+template <typename T>
+BasicFuzzyNumberBatch<T> BasicFuzzyNumberBatch<T>::apply_function( const std::function<T( const T & )> &func,
+                                                                   bool monotone, size_t number_elements ) const
+{
+    return apply_function<const std::function<T( const T & )> &>( func, monotone, number_elements );
+}
+
+template <typename T>
+BasicFuzzyNumberBatch<T> BasicFuzzyNumberBatch<T>::operator-() const
+{
+    std::vector<T> lower( m_lower.size() );
+    std::vector<T> upper( m_upper.size() );
+
+    for ( size_t i = 0; i < m_lower.size(); ++i )
+    {
+        lower[i] = -m_upper[i];
+        upper[i] = -m_lower[i];
+    }
+
+    return BasicFuzzyNumberBatch( already_validated, m_alphas, std::move( lower ), std::move( upper ) );
+}
+
+template <typename T>
+BasicFuzzyNumberBatch<T> BasicFuzzyNumberBatch<T>::operator+( const BasicFuzzyNumberBatch &other ) const
+{
+    check_compatible( other );
+
+    std::vector<T> lower( m_lower.size() );
+    std::vector<T> upper( m_upper.size() );
+
+    for ( size_t i = 0; i < m_lower.size(); ++i )
+    {
+        lower[i] = m_lower[i] + other.m_lower[i];
+        upper[i] = m_upper[i] + other.m_upper[i];
+    }
+
+    return BasicFuzzyNumberBatch( already_validated, m_alphas, std::move( lower ), std::move( upper ) );
+}
+
+template <typename T>
+BasicFuzzyNumberBatch<T> BasicFuzzyNumberBatch<T>::operator-( const BasicFuzzyNumberBatch &other ) const
+{
+    check_compatible( other );
+
+    std::vector<T> lower( m_lower.size() );
+    std::vector<T> upper( m_upper.size() );
+
+    for ( size_t i = 0; i < m_lower.size(); ++i )
+    {
+        lower[i] = m_lower[i] - other.m_upper[i];
+        upper[i] = m_upper[i] - other.m_lower[i];
+    }
+
+    return BasicFuzzyNumberBatch( already_validated, m_alphas, std::move( lower ), std::move( upper ) );
+}
+
+template <typename T>
+BasicFuzzyNumberBatch<T> BasicFuzzyNumberBatch<T>::operator*( const BasicFuzzyNumberBatch &other ) const
+{
+    check_compatible( other );
+
+    std::vector<T> lower( m_lower.size() );
+    std::vector<T> upper( m_upper.size() );
+
+    for ( size_t i = 0; i < m_lower.size(); ++i )
+    {
+        BasicInterval<T> result =
+            BasicInterval<T>( m_lower[i], m_upper[i] ) * BasicInterval<T>( other.m_lower[i], other.m_upper[i] );
+        lower[i] = result.min();
+        upper[i] = result.max();
+    }
+
+    return BasicFuzzyNumberBatch( already_validated, m_alphas, std::move( lower ), std::move( upper ) );
+}
+
+template <typename T>
+BasicFuzzyNumberBatch<T> BasicFuzzyNumberBatch<T>::operator/( const BasicFuzzyNumberBatch &other ) const
+{
+    check_compatible( other );
+
+    std::vector<T> lower( m_lower.size() );
+    std::vector<T> upper( m_upper.size() );
+
+    for ( size_t i = 0; i < m_lower.size(); ++i )
+    {
+        BasicInterval<T> result =
+            BasicInterval<T>( m_lower[i], m_upper[i] ) / BasicInterval<T>( other.m_lower[i], other.m_upper[i] );
+        lower[i] = result.min();
+        upper[i] = result.max();
+    }
+
+    return BasicFuzzyNumberBatch( already_validated, m_alphas, std::move( lower ), std::move( upper ) );
+}
+
+template <typename T>
+bool BasicFuzzyNumberBatch<T>::operator==( const BasicFuzzyNumberBatch &other ) const
+{
+    return m_alphas == other.m_alphas && m_lower == other.m_lower && m_upper == other.m_upper;
+}
+
+template class DLL_API FuzzyMath::BasicFuzzyNumberBatch<PreciseFloat>;
+template class DLL_API FuzzyMath::BasicFuzzyNumberBatch<double>;
+template class DLL_API FuzzyMath::BasicFuzzyNumberBatch<long double>;
+#ifdef FUZZYMATH_HAS_FLOAT128
+template class DLL_API FuzzyMath::BasicFuzzyNumberBatch<QuadFloat>;
+#endif
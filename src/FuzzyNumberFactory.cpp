@@ -1,10 +1,32 @@
-#include "FuzzyNumberFactory.h"
+#include <span>
+#include <string>
+#include <vector>
+
 #include "AlphaCut.h"
+#include "FuzzyNumberFactory.h"
 
 using namespace FuzzyMath;
 
-FuzzyNumber FuzzyNumberFactory::triangular( PreciseFloat minimum, PreciseFloat kernel, PreciseFloat maximum,
-                                            int number_of_cuts )
+namespace
+{
+    // The same levels as BasicFuzzyNumber::alpha_cut_values, allocated from memory_resource().
+    template <typename T>
+    typename BasicFuzzyNumber<T>::storage_type alpha_levels( int number_of_cuts )
+    {
+        typename BasicFuzzyNumber<T>::storage_type alphas( memory_resource() );
+        alphas.reserve( number_of_cuts );
+
+        for ( int i = 0; i < number_of_cuts; ++i )
+        {
+            alphas.push_back( T( i ) / T( number_of_cuts - 1 ) );
+        }
+
+        return alphas;
+    }
+} // namespace
+
+template <typename T>
+BasicFuzzyNumber<T> BasicFuzzyNumberFactory<T>::triangular( T minimum, T kernel, T maximum, int number_of_cuts )
 {
     if ( !( minimum <= kernel && kernel <= maximum ) )
     {
@@ -17,48 +39,37 @@ FuzzyNumber FuzzyNumberFactory::triangular( PreciseFloat minimum, PreciseFloat k
         throw std::invalid_argument( "Number of cuts must be at least 2." );
     }
 
-    std::set<AlphaCut> alpha_cuts;
+    typename BasicFuzzyNumber<T>::storage_type alphas = alpha_levels<T>( number_of_cuts );
+    typename BasicFuzzyNumber<T>::storage_type lower( alphas.size(), memory_resource() );
+    typename BasicFuzzyNumber<T>::storage_type upper( alphas.size(), memory_resource() );
 
-    if ( number_of_cuts == 2 )
+    for ( size_t i = 0; i < alphas.size(); ++i )
     {
-        alpha_cuts.emplace( 0, Interval( minimum, maximum ) );
-        alpha_cuts.emplace( 1, Interval( kernel ) );
+        lower[i] = minimum + ( kernel - minimum ) * alphas[i];
+        upper[i] = maximum - ( maximum - kernel ) * alphas[i];
     }
-    else
-    {
-        std::vector<PreciseFloat> alphas = FuzzyNumber::alpha_cut_values( number_of_cuts );
 
-        size_t i = 0;
+    // Bounds are exact at the first and the last alpha cut.
+    lower.front() = minimum;
+    upper.front() = maximum;
+    lower.back() = kernel;
+    upper.back() = kernel;
 
-        for ( PreciseFloat alpha : alphas )
-        {
-            if ( alpha == 0 )
-            {
-                alpha_cuts.emplace( 0, Interval( minimum, maximum ) );
-            }
-            else if ( alpha == 1 )
-            {
-                alpha_cuts.emplace( 1, Interval( kernel, kernel ) );
-            }
-            else
-            {
-                PreciseFloat int_min = ( ( kernel - minimum ) / ( number_of_cuts - 1 ) ) * i + minimum;
-                PreciseFloat int_max = maximum - ( ( maximum - kernel ) / ( number_of_cuts - 1 ) ) * i;
-                alpha_cuts.emplace( alpha, Interval( int_min, int_max ) );
-            }
-        }
-    }
-    return FuzzyNumber( alpha_cuts );
+    // Bounds are monotone in alpha, so alpha cuts are nested.
+    return BasicFuzzyNumber<T>( already_validated, std::move( alphas ), std::move( lower ), std::move( upper ) );
 }
 
-FuzzyNumber FuzzyNumberFactory::triangular( std::string minimum, std::string kernel, std::string maximum,
-                                            int number_of_cuts )
+template <typename T>
+BasicFuzzyNumber<T> BasicFuzzyNumberFactory<T>::triangular( std::string minimum, std::string kernel,
+                                                            std::string maximum, int number_of_cuts )
 {
-    return triangular( PreciseFloat( minimum ), PreciseFloat( kernel ), PreciseFloat( maximum ), number_of_cuts );
+    return triangular( number_from_string<T>( minimum ), number_from_string<T>( kernel ),
+                       number_from_string<T>( maximum ), number_of_cuts );
 }
 
-FuzzyNumber FuzzyNumberFactory::trapezoidal( PreciseFloat minimum, PreciseFloat kernel_minimum,
-                                             PreciseFloat kernel_maximum, PreciseFloat maximum, int number_of_cuts )
+template <typename T>
+BasicFuzzyNumber<T> BasicFuzzyNumberFactory<T>::trapezoidal( T minimum, T kernel_minimum, T kernel_maximum, T maximum,
+                                                             int number_of_cuts )
 {
     if ( !( minimum <= kernel_minimum && kernel_minimum <= kernel_maximum && kernel_maximum <= maximum ) )
     {
@@ -72,56 +83,151 @@ FuzzyNumber FuzzyNumberFactory::trapezoidal( PreciseFloat minimum, PreciseFloat
         throw std::invalid_argument( "Number of cuts must be at least 2." );
     }
 
-    std::set<AlphaCut> alpha_cuts;
+    typename BasicFuzzyNumber<T>::storage_type alphas = alpha_levels<T>( number_of_cuts );
+    typename BasicFuzzyNumber<T>::storage_type lower( alphas.size(), memory_resource() );
+    typename BasicFuzzyNumber<T>::storage_type upper( alphas.size(), memory_resource() );
 
-    if ( number_of_cuts == 2 )
+    for ( size_t i = 0; i < alphas.size(); ++i )
     {
-        alpha_cuts.emplace( 0, Interval( minimum, maximum ) );
-        alpha_cuts.emplace( 1, Interval( minimum, maximum ) );
+        lower[i] = minimum + ( kernel_minimum - minimum ) * alphas[i];
+        upper[i] = maximum - ( maximum - kernel_maximum ) * alphas[i];
     }
-    else
-    {
-        std::vector<PreciseFloat> alphas = FuzzyNumber::alpha_cut_values( number_of_cuts );
 
-        size_t i = 0;
+    lower.front() = minimum;
+    upper.front() = maximum;
+    lower.back() = kernel_minimum;
+    upper.back() = kernel_maximum;
+
+    return BasicFuzzyNumber<T>( already_validated, std::move( alphas ), std::move( lower ), std::move( upper ) );
+}
+
+template <typename T>
+BasicFuzzyNumber<T> BasicFuzzyNumberFactory<T>::trapezoidal( std::string minimum, std::string kernel_minimum,
+                                                             std::string kernel_maximum, std::string maximum,
+                                                             int number_of_cuts )
+{
+    return trapezoidal( number_from_string<T>( minimum ), number_from_string<T>( kernel_minimum ),
+                        number_from_string<T>( kernel_maximum ), number_from_string<T>( maximum ), number_of_cuts );
+}
+
+template <typename T>
+BasicFuzzyNumber<T> BasicFuzzyNumberFactory<T>::crisp_number( T value )
+{
+    using storage_type = typename BasicFuzzyNumber<T>::storage_type;
 
-        for ( PreciseFloat alpha : alphas )
+    return BasicFuzzyNumber<T>( already_validated, storage_type( { T( 0 ), T( 1 ) }, memory_resource() ),
+                                storage_type( { value, value }, memory_resource() ),
+                                storage_type( { value, value }, memory_resource() ) );
+}
+
+template <typename T>
+BasicFuzzyNumber<T> BasicFuzzyNumberFactory<T>::crisp_number( std::string value )
+{
+    return crisp_number( number_from_string<T>( value ) );
+}
+template <typename T>
+BasicFuzzyNumberBatch<T> BasicFuzzyNumberFactory<T>::triangular_batch( std::span<const T> minimum,
+                                                                       std::span<const T> kernel,
+                                                                       std::span<const T> maximum, int number_of_cuts )
+{
+    if ( kernel.size() != minimum.size() || maximum.size() != minimum.size() )
+    {
+        throw std::invalid_argument( "Columns of parameters must have the same size." );
+    }
+
+    for ( size_t row = 0; row < minimum.size(); ++row )
+    {
+        if ( !( minimum[row] <= kernel[row] && kernel[row] <= maximum[row] ) )
         {
-            if ( alpha == 0 )
-            {
-                alpha_cuts.emplace( 0, Interval( minimum, maximum ) );
-            }
-            else if ( alpha == 1 )
-            {
-                alpha_cuts.emplace( 1, Interval( kernel_minimum, kernel_maximum ) );
-            }
-            else
-            {
-                PreciseFloat int_min = ( ( kernel_minimum - minimum ) / ( number_of_cuts - 1 ) ) * i + minimum;
-                PreciseFloat int_max = maximum - ( ( maximum - kernel_maximum ) / ( number_of_cuts - 1 ) ) * i;
-                alpha_cuts.emplace( alpha, Interval( int_min, int_max ) );
-            }
+            throw std::invalid_argument( "The fuzzy number at row " + std::to_string( row ) +
+                                         " is invalid. The structure needs to be `minimum` <= `kernel` <= `maximum`." );
         }
     }
 
-    return FuzzyNumber( alpha_cuts );
+    return trapezoidal_batch( minimum, kernel, kernel, maximum, number_of_cuts );
 }
 
-FuzzyNumber FuzzyNumberFactory::trapezoidal( std::string minimum, std::string kernel_minimum,
-                                             std::string kernel_maximum, std::string maximum, int number_of_cuts )
+template <typename T>
+BasicFuzzyNumberBatch<T> BasicFuzzyNumberFactory<T>::trapezoidal_batch( std::span<const T> minimum,
+                                                                        std::span<const T> kernel_minimum,
+                                                                        std::span<const T> kernel_maximum,
+                                                                        std::span<const T> maximum, int number_of_cuts )
 {
-    return trapezoidal( PreciseFloat( minimum ), PreciseFloat( kernel_minimum ), PreciseFloat( kernel_maximum ),
-                        PreciseFloat( maximum ), number_of_cuts );
+    size_t size = minimum.size();
+
+    if ( kernel_minimum.size() != size || kernel_maximum.size() != size || maximum.size() != size )
+    {
+        throw std::invalid_argument( "Columns of parameters must have the same size." );
+    }
+
+    if ( number_of_cuts < 2 )
+    {
+        throw std::invalid_argument( "Number of cuts must be at least 2." );
+    }
+
+    for ( size_t row = 0; row < size; ++row )
+    {
+        if ( !( minimum[row] <= kernel_minimum[row] && kernel_minimum[row] <= kernel_maximum[row] &&
+                kernel_maximum[row] <= maximum[row] ) )
+        {
+            throw std::invalid_argument( "The fuzzy number at row " + std::to_string( row ) +
+                                         " is invalid. The structure needs to be `minimum` <= `kernel_minimum` "
+                                         "<= `kernel_maximum` <= `maximum`." );
+        }
+    }
+
+    std::vector<T> alphas = BasicFuzzyNumber<T>::alpha_cut_values( number_of_cuts );
+    size_t cuts = alphas.size();
+
+    std::vector<T> lower( size * cuts );
+    std::vector<T> upper( size * cuts );
+
+    for ( size_t row = 0; row < size; ++row )
+    {
+        T *row_lower = lower.data() + row * cuts;
+        T *row_upper = upper.data() + row * cuts;
+
+        T lower_slope = kernel_minimum[row] - minimum[row];
+        T upper_slope = maximum[row] - kernel_maximum[row];
+
+        // Same bounds as trapezoidal() computes for a single number, in a loop without branches.
+        for ( size_t i = 0; i < cuts; ++i )
+        {
+            row_lower[i] = minimum[row] + lower_slope * alphas[i];
+            row_upper[i] = maximum[row] - upper_slope * alphas[i];
+        }
+
+        row_lower[0] = minimum[row];
+        row_upper[0] = maximum[row];
+        row_lower[cuts - 1] = kernel_minimum[row];
+        row_upper[cuts - 1] = kernel_maximum[row];
+    }
+
+    return BasicFuzzyNumberBatch<T>( already_validated, std::move( alphas ), std::move( lower ), std::move( upper ) );
 }
 
-FuzzyNumber FuzzyNumberFactory::crisp_number( PreciseFloat value )
+template <typename T>
+std::vector<BasicFuzzyNumber<T>> BasicFuzzyNumberFactory<T>::triangular( std::span<const T> minimum,
+                                                                         std::span<const T> kernel,
+                                                                         std::span<const T> maximum,
+                                                                         int number_of_cuts )
 {
-    std::set<AlphaCut> alpha_cuts;
-
-    alpha_cuts.emplace( 0, Interval( value ) );
-    alpha_cuts.emplace( 1, Interval( value ) );
+    return triangular_batch( minimum, kernel, maximum, number_of_cuts ).fuzzy_numbers();
+}
 
-    return FuzzyNumber( alpha_cuts );
+template <typename T>
+std::vector<BasicFuzzyNumber<T>> BasicFuzzyNumberFactory<T>::trapezoidal( std::span<const T> minimum,
+                                                                          std::span<const T> kernel_minimum,
+                                                                          std::span<const T> kernel_maximum,
+                                                                          std::span<const T> maximum,
+                                                                          int number_of_cuts )
+{
+    return trapezoidal_batch( minimum, kernel_minimum, kernel_maximum, maximum, number_of_cuts ).fuzzy_numbers();
 }
 
-FuzzyNumber FuzzyNumberFactory::crisp_number( std::string value ) { return crisp_number( PreciseFloat( value ) ); }
\ No newline at end of file
+template class DLL_API FuzzyMath::BasicFuzzyNumberFactory<PreciseFloat>;
+template class DLL_API FuzzyMath::BasicFuzzyNumberFactory<double>;
+template class DLL_API FuzzyMath::BasicFuzzyNumberFactory<long double>;
+#ifdef FUZZYMATH_HAS_FLOAT128
+template class DLL_API FuzzyMath::BasicFuzzyNumberFactory<QuadFloat>;
+#endif
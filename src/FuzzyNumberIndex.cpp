@@ -0,0 +1,180 @@
+#include <algorithm>
+#include <optional>
+
+#include "FuzzyNumberIndex.h"
+
+using namespace FuzzyMath;
+
+template <typename T>
+BasicFuzzyNumberIndex<T>::BasicFuzzyNumberIndex( std::vector<BasicFuzzyNumber<T>> numbers, DistanceMetric metric )
+    : m_numbers( std::move( numbers ) ), m_metric( metric )
+{
+    std::vector<size_t> indices( m_numbers.size() );
+    std::vector<T> distances( m_numbers.size() );
+
+    for ( size_t i = 0; i < indices.size(); ++i )
+    {
+        indices[i] = i;
+    }
+
+    m_nodes.reserve( m_numbers.size() );
+    m_root = build( indices, distances, 0, indices.size() );
+}
+
+template <typename T>
+size_t BasicFuzzyNumberIndex<T>::size() const { return m_numbers.size(); }
+
+template <typename T>
+DistanceMetric BasicFuzzyNumberIndex<T>::metric() const { return m_metric; }
+
+template <typename T>
+const BasicFuzzyNumber<T> &BasicFuzzyNumberIndex<T>::operator[]( size_t index ) const { return m_numbers[index]; }
+
+template <typename T>
+T BasicFuzzyNumberIndex<T>::distance( const BasicFuzzyNumber<T> &a, const BasicFuzzyNumber<T> &b ) const
+{
+    return BasicFuzzyDistance<T>::distance( a, b, m_metric );
+}
+
+template <typename T>
+size_t BasicFuzzyNumberIndex<T>::build( std::vector<size_t> &indices, std::vector<T> &distances, size_t first,
+                                        size_t last )
+{
+    if ( first == last )
+        return no_node;
+
+    size_t vantage_point = indices[first];
+    size_t node = m_nodes.size();
+    m_nodes.push_back( Node{ vantage_point, T( 0 ) } );
+
+    if ( last - first == 1 )
+        return node;
+
+    for ( size_t i = first + 1; i < last; ++i )
+    {
+        distances[indices[i]] = distance( m_numbers[vantage_point], m_numbers[indices[i]] );
+    }
+
+    // The median splits the remaining numbers in halves, which keeps the tree balanced.
+    size_t middle = first + 1 + ( last - first - 1 ) / 2;
+    std::nth_element( indices.begin() + first + 1, indices.begin() + middle, indices.begin() + last,
+                      [&distances]( size_t a, size_t b ) { return distances[a] < distances[b]; } );
+
+    T threshold = distances[indices[middle]];
+    size_t inside = build( indices, distances, first + 1, middle );
+    size_t outside = build( indices, distances, middle, last );
+
+    m_nodes[node].threshold = threshold;
+    m_nodes[node].inside = inside;
+    m_nodes[node].outside = outside;
+
+    return node;
+}
+
+template <typename T>
+template <typename R, typename A>
+void BasicFuzzyNumberIndex<T>::search( size_t node, const BasicFuzzyNumber<T> &query, R &&radius, A &&accept ) const
+{
+    if ( node == no_node )
+        return;
+
+    const Node &current = m_nodes[node];
+    T query_distance = distance( query, m_numbers[current.vantage_point] );
+    accept( current.vantage_point, query_distance );
+
+    // By the triangle inequality, the inside subtree holds a match only if query_distance - radius <= threshold and
+    // the outside one only if query_distance + radius >= threshold. The side of the query is searched first, so the
+    // radius of nearest neighbour search shrinks early.
+    bool inside_first = query_distance < current.threshold;
+
+    for ( bool inside : { inside_first, !inside_first } )
+    {
+        std::optional<T> bound = radius();
+
+        if ( inside && ( !bound || query_distance - *bound <= current.threshold ) )
+        {
+            search( current.inside, query, radius, accept );
+        }
+        else if ( !inside && ( !bound || query_distance + *bound >= current.threshold ) )
+        {
+            search( current.outside, query, radius, accept );
+        }
+    }
+}
+
+template <typename T>
+std::vector<typename BasicFuzzyNumberIndex<T>::Neighbour>
+BasicFuzzyNumberIndex<T>::nearest( const BasicFuzzyNumber<T> &query, size_t k ) const
+{
+    std::vector<Neighbour> neighbours;
+
+    if ( k == 0 )
+        return neighbours;
+
+    neighbours.reserve( std::min( k, size() ) );
+
+    auto closer = []( const Neighbour &a, const Neighbour &b )
+    { return a.distance < b.distance || ( a.distance == b.distance && a.index < b.index ); };
+
+    // Max-heap of the k closest numbers found so far, the farthest of them bounds the search once there are k.
+    auto radius = [&]() -> std::optional<T>
+    {
+        if ( neighbours.size() < k )
+            return std::nullopt;
+        return neighbours.front().distance;
+    };
+
+    auto accept = [&]( size_t index, const T &distance )
+    {
+        Neighbour candidate{ index, distance };
+
+        if ( neighbours.size() < k )
+        {
+            neighbours.push_back( candidate );
+            std::push_heap( neighbours.begin(), neighbours.end(), closer );
+        }
+        else if ( closer( candidate, neighbours.front() ) )
+        {
+            std::pop_heap( neighbours.begin(), neighbours.end(), closer );
+            neighbours.back() = candidate;
+            std::push_heap( neighbours.begin(), neighbours.end(), closer );
+        }
+    };
+
+    search( m_root, query, radius, accept );
+
+    std::sort_heap( neighbours.begin(), neighbours.end(), closer );
+    return neighbours;
+}
+
+template <typename T>
+std::vector<typename BasicFuzzyNumberIndex<T>::Neighbour>
+BasicFuzzyNumberIndex<T>::within( const BasicFuzzyNumber<T> &query, const T &radius ) const
+{
+    std::vector<Neighbour> neighbours;
+
+    if ( radius < T( 0 ) )
+        return neighbours;
+
+    auto bound = [&radius]() -> std::optional<T> { return radius; };
+
+    auto accept = [&]( size_t index, const T &distance )
+    {
+        if ( distance <= radius )
+            neighbours.push_back( Neighbour{ index, distance } );
+    };
+
+    search( m_root, query, bound, accept );
+
+    std::sort( neighbours.begin(), neighbours.end(),
+               []( const Neighbour &a, const Neighbour &b )
+               { return a.distance < b.distance || ( a.distance == b.distance && a.index < b.index ); } );
+    return neighbours;
+}
+
+template class DLL_API FuzzyMath::BasicFuzzyNumberIndex<PreciseFloat>;
+template class DLL_API FuzzyMath::BasicFuzzyNumberIndex<double>;
+template class DLL_API FuzzyMath::BasicFuzzyNumberIndex<long double>;
+#ifdef FUZZYMATH_HAS_FLOAT128
+template class DLL_API FuzzyMath::BasicFuzzyNumberIndex<QuadFloat>;
+#endif
@@ -0,0 +1,458 @@
+#include <array>
+#include <charconv>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+#include "FuzzyNumberFactory.h"
+#include "FuzzyNumberParser.h"
+
+using namespace FuzzyMath;
+
+namespace
+{
+    constexpr std::array<std::uint64_t, 20> powers_of_ten = { 1ULL,
+                                                              10ULL,
+                                                              100ULL,
+                                                              1000ULL,
+                                                              10000ULL,
+                                                              100000ULL,
+                                                              1000000ULL,
+                                                              10000000ULL,
+                                                              100000000ULL,
+                                                              1000000000ULL,
+                                                              10000000000ULL,
+                                                              100000000000ULL,
+                                                              1000000000000ULL,
+                                                              10000000000000ULL,
+                                                              100000000000000ULL,
+                                                              1000000000000000ULL,
+                                                              10000000000000000ULL,
+                                                              100000000000000000ULL,
+                                                              1000000000000000000ULL,
+                                                              10000000000000000000ULL };
+
+    constexpr int max_fast_digits = 19;
+
+    bool is_digit( char c ) { return c >= '0' && c <= '9'; }
+
+    std::string_view trim( std::string_view field )
+    {
+        while ( !field.empty() && ( field.front() == ' ' || field.front() == '\t' ) )
+            field.remove_prefix( 1 );
+
+        while ( !field.empty() && ( field.back() == ' ' || field.back() == '\t' ) )
+            field.remove_suffix( 1 );
+
+        return field;
+    }
+
+    // Decimal number in the form [+-]digits[.digits][(e|E)[+-]digits]. Numbers with at most 19 significant digits and
+    // exponent of at most 19 are computed from integer mantissa, which is exact for decimal types and correctly rounded
+    // for binary types with at least 64 bits of mantissa. Other numbers are passed to the string constructor of T.
+    template <typename T>
+    bool parse_decimal( std::string_view field, T &value )
+    {
+        const char *p = field.data();
+        const char *end = p + field.size();
+
+        bool negative = false;
+
+        if ( p != end && ( *p == '+' || *p == '-' ) )
+        {
+            negative = *p == '-';
+            ++p;
+        }
+
+        std::uint64_t mantissa = 0;
+        int digits = 0;
+        int exponent = 0;
+        bool any_digit = false;
+        bool fast = true;
+
+        for ( ; p != end && is_digit( *p ); ++p )
+        {
+            any_digit = true;
+
+            if ( mantissa == 0 && *p == '0' )
+                continue;
+
+            if ( digits < max_fast_digits )
+            {
+                mantissa = mantissa * 10 + static_cast<std::uint64_t>( *p - '0' );
+                ++digits;
+            }
+            else
+            {
+                fast = false;
+            }
+        }
+
+        if ( p != end && *p == '.' )
+        {
+            for ( ++p; p != end && is_digit( *p ); ++p )
+            {
+                any_digit = true;
+
+                if ( mantissa == 0 && *p == '0' )
+                {
+                    --exponent;
+                    continue;
+                }
+
+                if ( digits < max_fast_digits )
+                {
+                    mantissa = mantissa * 10 + static_cast<std::uint64_t>( *p - '0' );
+                    ++digits;
+                    --exponent;
+                }
+                else
+                {
+                    fast = false;
+                }
+            }
+        }
+
+        if ( !any_digit )
+            return false;
+
+        if ( p != end && ( *p == 'e' || *p == 'E' ) )
+        {
+            ++p;
+            bool negative_exponent = false;
+
+            if ( p != end && ( *p == '+' || *p == '-' ) )
+            {
+                negative_exponent = *p == '-';
+                ++p;
+            }
+
+            if ( p == end || !is_digit( *p ) )
+                return false;
+
+            int explicit_exponent = 0;
+
+            for ( ; p != end && is_digit( *p ); ++p )
+            {
+                if ( explicit_exponent < 100000 )
+                    explicit_exponent = explicit_exponent * 10 + ( *p - '0' );
+            }
+
+            exponent += negative_exponent ? -explicit_exponent : explicit_exponent;
+        }
+
+        if ( p != end )
+            return false;
+
+        if ( mantissa == 0 && fast )
+        {
+            value = negative ? -T( 0 ) : T( 0 );
+            return true;
+        }
+
+        if ( fast && exponent >= -max_fast_digits && exponent <= max_fast_digits )
+        {
+            value = T( mantissa );
+
+            if ( exponent > 0 )
+                value *= T( powers_of_ten[exponent] );
+            else if ( exponent < 0 )
+                value /= T( powers_of_ten[-exponent] );
+
+            if ( negative )
+                value = -value;
+
+            return true;
+        }
+
+        // Syntax was checked above, so the string constructor only sees valid numbers.
+        try
+        {
+            std::array<char, 128> buffer;
+
+            if ( field.size() < buffer.size() )
+            {
+                std::memcpy( buffer.data(), field.data(), field.size() );
+                buffer[field.size()] = '\0';
+                value = T( buffer.data() );
+            }
+            else
+            {
+                value = T( std::string( field ) );
+            }
+        }
+        catch ( const std::exception & )
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    template <typename T>
+    bool parse_number( std::string_view field, T &value )
+    {
+        if constexpr ( std::is_floating_point_v<T> )
+        {
+            // std::from_chars does not accept leading plus sign.
+            if ( field.size() > 1 && field.front() == '+' && field[1] != '-' )
+                field.remove_prefix( 1 );
+
+            const char *end = field.data() + field.size();
+            auto [position, error] = std::from_chars( field.data(), end, value );
+
+            return error == std::errc() && position == end;
+        }
+        else
+        {
+            return parse_decimal( field, value );
+        }
+    }
+} // namespace
+
+template <typename T>
+BasicFuzzyNumberParser<T>::BasicFuzzyNumberParser( RecordFormat format, char delimiter, int number_of_cuts )
+    : m_format( format ), m_delimiter( delimiter ), m_number_of_cuts( number_of_cuts )
+{
+    if ( number_of_cuts < 2 )
+    {
+        throw std::invalid_argument( "Number of cuts must be at least 2." );
+    }
+}
+
+template <typename T>
+size_t BasicFuzzyNumberParser<T>::row() const { return m_row; }
+
+template <typename T>
+void BasicFuzzyNumberParser<T>::reset() { m_row = 0; }
+
+template <typename T>
+bool BasicFuzzyNumberParser<T>::read_fields( std::string_view line, std::vector<ParseError> &errors )
+{
+    m_values.clear();
+    m_columns.clear();
+
+    size_t start = 0;
+
+    while ( true )
+    {
+        size_t stop = line.find( m_delimiter, start );
+        std::string_view field = line.substr( start, stop == std::string_view::npos ? stop : stop - start );
+
+        size_t column = start + 1;
+        std::string_view trimmed = trim( field );
+
+        if ( !trimmed.empty() )
+            column = static_cast<size_t>( trimmed.data() - line.data() ) + 1;
+
+        m_columns.push_back( column );
+        m_values.emplace_back();
+
+        if ( !parse_number( trimmed, m_values.back() ) )
+        {
+            errors.push_back( { m_row, column, "Field is not a number." } );
+            return false;
+        }
+
+        if ( stop == std::string_view::npos )
+            return true;
+
+        start = stop + 1;
+    }
+}
+
+template <typename T>
+bool BasicFuzzyNumberParser<T>::check_field_count( size_t expected, bool multiple, size_t line_length,
+                                                   std::vector<ParseError> &errors )
+{
+    size_t count = m_values.size();
+
+    if ( multiple ? ( count >= 2 * expected && count % expected == 0 ) : count == expected )
+        return true;
+
+    if ( multiple )
+    {
+        size_t column = count < 2 * expected ? line_length + 1 : m_columns[count - count % expected];
+        errors.push_back( { m_row, column, "Record must consist of at least two alpha cuts of three fields." } );
+    }
+    else if ( count < expected )
+    {
+        errors.push_back( { m_row, line_length + 1, "Record has too few fields." } );
+    }
+    else
+    {
+        errors.push_back( { m_row, m_columns[expected], "Record has too many fields." } );
+    }
+
+    return false;
+}
+
+template <typename T>
+template <typename R>
+size_t BasicFuzzyNumberParser<T>::parse_lines( std::string_view buffer, bool last, std::vector<ParseError> &errors,
+                                               R &&record )
+{
+    size_t position = 0;
+
+    while ( position < buffer.size() )
+    {
+        size_t stop = buffer.find( '\n', position );
+
+        if ( stop == std::string_view::npos && !last )
+            break;
+
+        std::string_view line =
+            buffer.substr( position, stop == std::string_view::npos ? std::string_view::npos : stop - position );
+        position = stop == std::string_view::npos ? buffer.size() : stop + 1;
+
+        ++m_row;
+
+        if ( !line.empty() && line.back() == '\r' )
+            line.remove_suffix( 1 );
+
+        if ( trim( line ).empty() )
+            continue;
+
+        if ( read_fields( line, errors ) )
+            record( line );
+    }
+
+    return position;
+}
+
+template <typename T>
+size_t BasicFuzzyNumberParser<T>::parse( std::string_view buffer, std::vector<BasicFuzzyNumber<T>> &output,
+                                         std::vector<ParseError> &errors, bool last )
+{
+    return parse_lines(
+        buffer, last, errors,
+        [&]( std::string_view line )
+        {
+            const std::vector<T> &v = m_values;
+
+            if ( m_format == RecordFormat::Triangular )
+            {
+                if ( !check_field_count( 3, false, line.size(), errors ) )
+                    return;
+
+                for ( size_t i = 1; i < 3; ++i )
+                {
+                    if ( !( v[i - 1] <= v[i] ) )
+                    {
+                        errors.push_back( { m_row, m_columns[i], "Parameters of fuzzy number are not ordered." } );
+                        return;
+                    }
+                }
+
+                output.push_back( BasicFuzzyNumberFactory<T>::triangular( v[0], v[1], v[2], m_number_of_cuts ) );
+            }
+            else if ( m_format == RecordFormat::Trapezoidal )
+            {
+                if ( !check_field_count( 4, false, line.size(), errors ) )
+                    return;
+
+                for ( size_t i = 1; i < 4; ++i )
+                {
+                    if ( !( v[i - 1] <= v[i] ) )
+                    {
+                        errors.push_back( { m_row, m_columns[i], "Parameters of fuzzy number are not ordered." } );
+                        return;
+                    }
+                }
+
+                output.push_back(
+                    BasicFuzzyNumberFactory<T>::trapezoidal( v[0], v[1], v[2], v[3], m_number_of_cuts ) );
+            }
+            else
+            {
+                if ( !check_field_count( 3, true, line.size(), errors ) )
+                    return;
+
+                size_t cuts = v.size() / 3;
+
+                // The same conditions as BasicFuzzyNumber::validate, checked here to report the position.
+                for ( size_t i = 0; i < cuts; ++i )
+                {
+                    const T &alpha = v[3 * i];
+                    const T &lower = v[3 * i + 1];
+                    const T &upper = v[3 * i + 2];
+
+                    if ( ( i == 0 && alpha != T( 0 ) ) || ( i == cuts - 1 && alpha != T( 1 ) ) )
+                    {
+                        errors.push_back( { m_row, m_columns[3 * i], "Alpha levels must go from 0 to 1." } );
+                        return;
+                    }
+
+                    if ( i > 0 && !( v[3 * ( i - 1 )] < alpha ) )
+                    {
+                        errors.push_back( { m_row, m_columns[3 * i], "Alpha levels must be strictly increasing." } );
+                        return;
+                    }
+
+                    if ( !( lower <= upper ) )
+                    {
+                        errors.push_back( { m_row, m_columns[3 * i + 2], "Lower bound is greater than upper bound." } );
+                        return;
+                    }
+
+                    if ( !( v[1] <= lower && upper <= v[2] ) )
+                    {
+                        errors.push_back( { m_row, m_columns[3 * i + 1], "Alpha cuts are not nested." } );
+                        return;
+                    }
+                }
+
+                typename BasicFuzzyNumber<T>::storage_type alphas( cuts, memory_resource() );
+                typename BasicFuzzyNumber<T>::storage_type lower( cuts, memory_resource() );
+                typename BasicFuzzyNumber<T>::storage_type upper( cuts, memory_resource() );
+
+                for ( size_t i = 0; i < cuts; ++i )
+                {
+                    alphas[i] = v[3 * i];
+                    lower[i] = v[3 * i + 1];
+                    upper[i] = v[3 * i + 2];
+                }
+
+                output.emplace_back( already_validated, std::move( alphas ), std::move( lower ), std::move( upper ) );
+            }
+        } );
+}
+
+template <typename T>
+size_t BasicFuzzyNumberParser<T>::parse_intervals( std::string_view buffer, std::vector<BasicInterval<T>> &output,
+                                                   std::vector<ParseError> &errors, bool last )
+{
+    return parse_lines( buffer, last, errors,
+                        [&]( std::string_view line )
+                        {
+                            if ( check_field_count( 2, false, line.size(), errors ) )
+                                output.emplace_back( m_values[0], m_values[1] );
+                        } );
+}
+
+template <typename T>
+std::vector<BasicFuzzyNumber<T>> BasicFuzzyNumberParser<T>::parse( std::string_view text,
+                                                                   std::vector<ParseError> &errors )
+{
+    std::vector<BasicFuzzyNumber<T>> output;
+    reset();
+    parse( text, output, errors, true );
+    return output;
+}
+
+template <typename T>
+std::vector<BasicInterval<T>> BasicFuzzyNumberParser<T>::parse_intervals( std::string_view text,
+                                                                          std::vector<ParseError> &errors )
+{
+    std::vector<BasicInterval<T>> output;
+    reset();
+    parse_intervals( text, output, errors, true );
+    return output;
+}
+
+template class DLL_API FuzzyMath::BasicFuzzyNumberParser<PreciseFloat>;
+template class DLL_API FuzzyMath::BasicFuzzyNumberParser<double>;
+template class DLL_API FuzzyMath::BasicFuzzyNumberParser<long double>;
+#ifdef FUZZYMATH_HAS_FLOAT128
+template class DLL_API FuzzyMath::BasicFuzzyNumberParser<QuadFloat>;
+#endif
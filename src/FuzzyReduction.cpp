@@ -0,0 +1,271 @@
+#include <algorithm>
+#include <future>
+#include <memory_resource>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+
+#include "FuzzyReduction.h"
+#include "Instrumentation.h"
+#include "MemoryResource.h"
+
+using namespace FuzzyMath;
+
+namespace
+{
+    // Union of alpha levels of all numbers. Neighbouring numbers usually share their alpha levels, which are then
+    // merged only once.
+    template <typename T>
+    std::pmr::vector<T> merged_levels( std::span<const BasicFuzzyNumber<T>> numbers )
+    {
+        std::pmr::vector<T> levels( memory_resource() );
+        std::span<const T> previous;
+
+        for ( const BasicFuzzyNumber<T> &number : numbers )
+        {
+            std::span<const T> alphas = number.alpha_levels();
+
+            if ( std::equal( alphas.begin(), alphas.end(), previous.begin(), previous.end() ) )
+                continue;
+
+            levels.insert( levels.end(), alphas.begin(), alphas.end() );
+            previous = alphas;
+        }
+
+        std::sort( levels.begin(), levels.end() );
+        levels.erase( std::unique( levels.begin(), levels.end() ), levels.end() );
+
+        return levels;
+    }
+
+    // Calls visit( level, lower, upper ) with bounds of alpha cut of number at every level, interpolated between its
+    // own alpha levels, which must all be among levels.
+    template <typename T, typename V>
+    void for_each_level( const BasicFuzzyNumber<T> &number, std::span<const T> levels, V &&visit )
+    {
+        std::span<const T> alphas = number.alpha_levels();
+        std::span<const T> lower = number.lower_bounds();
+        std::span<const T> upper = number.upper_bounds();
+
+        size_t k = 0;
+
+        for ( size_t level = 0; level < levels.size(); ++level )
+        {
+            const T &alpha = levels[level];
+
+            // The last alpha level is 1, so k stays in range.
+            while ( alphas[k] < alpha )
+                ++k;
+
+            if ( alphas[k] == alpha )
+            {
+                visit( level, lower[k], upper[k] );
+            }
+            else
+            {
+                T t = ( alpha - alphas[k - 1] ) / ( alphas[k] - alphas[k - 1] );
+                visit( level, T( lower[k - 1] + t * ( lower[k] - lower[k - 1] ) ),
+                       T( upper[k - 1] + t * ( upper[k] - upper[k - 1] ) ) );
+            }
+        }
+    }
+
+    // Operations of reductions: accumulate adds alpha cut of numbers[index] to a partial result, combine merges two
+    // partial results.
+    template <typename T>
+    struct SumOperation
+    {
+        static T identity() { return T( 0 ); }
+
+        void accumulate( size_t, T &lower, T &upper, const T &cut_lower, const T &cut_upper ) const
+        {
+            lower += cut_lower;
+            upper += cut_upper;
+        }
+
+        void combine( T &lower, T &upper, const T &other_lower, const T &other_upper ) const
+        {
+            lower += other_lower;
+            upper += other_upper;
+        }
+    };
+
+    template <typename T>
+    struct WeightedSumOperation : SumOperation<T>
+    {
+        std::span<const T> weights;
+
+        void accumulate( size_t index, T &lower, T &upper, const T &cut_lower, const T &cut_upper ) const
+        {
+            const T &weight = weights[index];
+
+            // Negative weight reverses the order of bounds.
+            if ( weight < T( 0 ) )
+            {
+                lower += weight * cut_upper;
+                upper += weight * cut_lower;
+            }
+            else
+            {
+                lower += weight * cut_lower;
+                upper += weight * cut_upper;
+            }
+        }
+    };
+
+    template <typename T>
+    struct ProductOperation
+    {
+        static T identity() { return T( 1 ); }
+
+        void accumulate( size_t, T &lower, T &upper, const T &cut_lower, const T &cut_upper ) const
+        {
+            combine( lower, upper, cut_lower, cut_upper );
+        }
+
+        void combine( T &lower, T &upper, const T &other_lower, const T &other_upper ) const
+        {
+            BasicInterval<T> product = BasicInterval<T>( lower, upper ) * BasicInterval<T>( other_lower, other_upper );
+            lower = product.min();
+            upper = product.max();
+        }
+    };
+
+    template <typename T, typename Op>
+    BasicFuzzyNumber<T> reduce( std::span<const BasicFuzzyNumber<T>> numbers, const Op &operation,
+                                size_t number_of_threads )
+    {
+        FUZZYMATH_TIME( Operation );
+
+        if ( numbers.empty() )
+        {
+            throw std::invalid_argument( "Reduction needs at least one fuzzy number." );
+        }
+
+        std::pmr::vector<T> levels = merged_levels( numbers );
+        size_t number_levels = levels.size();
+
+        FUZZYMATH_COUNT( AlphaLevels, number_levels );
+
+        constexpr size_t block_size = BasicFuzzyReduction<T>::block_size;
+        size_t number_blocks = ( numbers.size() + block_size - 1 ) / block_size;
+
+        // Partial results of blocks, row-major matrices of size number of blocks x number of alpha levels.
+        std::pmr::vector<T> lower( number_blocks * number_levels, Op::identity(), memory_resource() );
+        std::pmr::vector<T> upper( number_blocks * number_levels, Op::identity(), memory_resource() );
+
+        auto accumulate_blocks = [&]( size_t first_block, size_t last_block )
+        {
+            for ( size_t block = first_block; block < last_block; ++block )
+            {
+                T *block_lower = lower.data() + block * number_levels;
+                T *block_upper = upper.data() + block * number_levels;
+                size_t last = std::min( ( block + 1 ) * block_size, numbers.size() );
+
+                for ( size_t index = block * block_size; index < last; ++index )
+                {
+                    for_each_level( numbers[index], std::span<const T>( levels ),
+                                    [&]( size_t level, const T &cut_lower, const T &cut_upper )
+                                    {
+                                        operation.accumulate( index, block_lower[level], block_upper[level], cut_lower,
+                                                              cut_upper );
+                                    } );
+                }
+            }
+        };
+
+        if ( number_of_threads == 0 )
+        {
+            number_of_threads = std::max( std::thread::hardware_concurrency(), 1u );
+        }
+
+        size_t number_chunks = std::min( number_of_threads, number_blocks );
+        size_t chunk_size = number_blocks / number_chunks;
+        size_t remainder = number_blocks % number_chunks;
+
+        auto chunk_start = [chunk_size, remainder]( size_t chunk )
+        { return chunk * chunk_size + std::min( chunk, remainder ); };
+
+        // First chunk of blocks is accumulated on the calling thread, others asynchronously.
+        std::pmr::vector<std::future<void>> chunks( memory_resource() );
+        chunks.reserve( number_chunks - 1 );
+
+        for ( size_t chunk = 1; chunk < number_chunks; ++chunk )
+        {
+            chunks.push_back(
+                std::async( std::launch::async, accumulate_blocks, chunk_start( chunk ), chunk_start( chunk + 1 ) ) );
+        }
+
+        accumulate_blocks( 0, chunk_start( 1 ) );
+
+        for ( std::future<void> &chunk : chunks )
+        {
+            chunk.get();
+        }
+
+        // Pairwise tree over blocks, the first block ends up with the result.
+        for ( size_t stride = 1; stride < number_blocks; stride *= 2 )
+        {
+            for ( size_t block = 0; block + stride < number_blocks; block += 2 * stride )
+            {
+                size_t target = block * number_levels;
+                size_t source = ( block + stride ) * number_levels;
+
+                for ( size_t level = 0; level < number_levels; ++level )
+                {
+                    operation.combine( lower[target + level], upper[target + level], lower[source + level],
+                                       upper[source + level] );
+                }
+            }
+        }
+
+        lower.resize( number_levels );
+        upper.resize( number_levels );
+
+        // Interval arithmetic is inclusion isotone, so alpha cuts of the result are nested.
+        BasicFuzzyNumber<T> result( already_validated, std::move( levels ), std::move( lower ), std::move( upper ) );
+
+        if ( std::optional<T> tolerance = BasicFuzzyNumber<T>::auto_simplify() )
+        {
+            return result.simplify( *tolerance );
+        }
+
+        return result;
+    }
+} // namespace
+
+template <typename T>
+BasicFuzzyNumber<T> BasicFuzzyReduction<T>::sum( std::span<const BasicFuzzyNumber<T>> numbers,
+                                                 size_t number_of_threads )
+{
+    return reduce( numbers, SumOperation<T>(), number_of_threads );
+}
+
+template <typename T>
+BasicFuzzyNumber<T> BasicFuzzyReduction<T>::product( std::span<const BasicFuzzyNumber<T>> numbers,
+                                                     size_t number_of_threads )
+{
+    return reduce( numbers, ProductOperation<T>(), number_of_threads );
+}
+
+template <typename T>
+BasicFuzzyNumber<T> BasicFuzzyReduction<T>::weighted_sum( std::span<const BasicFuzzyNumber<T>> numbers,
+                                                          std::span<const T> weights, size_t number_of_threads )
+{
+    if ( weights.size() != numbers.size() )
+    {
+        throw std::invalid_argument( "Weighted sum needs one weight per fuzzy number." );
+    }
+
+    WeightedSumOperation<T> operation;
+    operation.weights = weights;
+
+    return reduce( numbers, operation, number_of_threads );
+}
+
+template class DLL_API FuzzyMath::BasicFuzzyReduction<PreciseFloat>;
+template class DLL_API FuzzyMath::BasicFuzzyReduction<double>;
+template class DLL_API FuzzyMath::BasicFuzzyReduction<long double>;
+#ifdef FUZZYMATH_HAS_FLOAT128
+template class DLL_API FuzzyMath::BasicFuzzyReduction<QuadFloat>;
+#endif
@@ -0,0 +1,32 @@
+#include <atomic>
+
+#include "Instrumentation.h"
+
+using namespace FuzzyMath;
+
+namespace
+{
+    thread_local Instrumentation::Snapshot thread_statistics;
+
+    std::atomic<bool> timers_switch{ false };
+} // namespace
+
+Instrumentation::Snapshot Instrumentation::snapshot() { return thread_statistics; }
+
+void Instrumentation::reset() { thread_statistics = Snapshot(); }
+
+void Instrumentation::enable_timers( bool enable ) { timers_switch.store( enable, std::memory_order_relaxed ); }
+
+bool Instrumentation::timers_enabled() { return enabled && timers_switch.load( std::memory_order_relaxed ); }
+
+void Instrumentation::add( Counter counter, std::uint64_t value )
+{
+    thread_statistics.counters[static_cast<size_t>( counter )] += value;
+}
+
+void Instrumentation::add_time( Timer timer, std::chrono::nanoseconds elapsed )
+{
+    TimerStatistics &statistics = thread_statistics.timers[static_cast<size_t>( timer )];
+    statistics.calls += 1;
+    statistics.elapsed += elapsed;
+}
@@ -9,42 +9,74 @@
 
 using namespace FuzzyMath;
 
-Interval::Interval() : m_interval_value( boost::numeric::interval<PreciseFloat>() )
+namespace
 {
-    m_interval_value.set( std::numeric_limits<PreciseFloat>::quiet_NaN(),
-                          std::numeric_limits<PreciseFloat>::quiet_NaN() );
+    // Sign class of interval used to select the bounds of multiplication and division.
+    enum class Sign
+    {
+        Negative,
+        Mixed,
+        Positive
+    };
+
+    template <typename T>
+    Sign sign_of( const T &min, const T &max )
+    {
+        if ( min >= T( 0 ) )
+            return Sign::Positive;
+        if ( max <= T( 0 ) )
+            return Sign::Negative;
+        return Sign::Mixed;
+    }
+} // namespace
+
+template <typename T>
+BasicInterval<T>::BasicInterval() : m_interval_value( boost::numeric::interval<T>() )
+{
+    m_interval_value.set( std::numeric_limits<T>::quiet_NaN(), std::numeric_limits<T>::quiet_NaN() );
 }
 
-Interval::Interval( const PreciseFloat &a ) : Interval( a, a ) {}
+template <typename T>
+BasicInterval<T>::BasicInterval( const T &a ) : BasicInterval( a, a ) {}
 
-Interval::Interval( const PreciseFloat &a, const PreciseFloat &b )
-    : m_interval_value( boost::numeric::interval<PreciseFloat>( std::min( a, b ), std::max( a, b ) ) )
+template <typename T>
+BasicInterval<T>::BasicInterval( const T &a, const T &b )
+    : m_interval_value( boost::numeric::interval<T>( std::min( a, b ), std::max( a, b ) ) )
 {
 }
 
-Interval::Interval( const std::string &a, const std::string &b )
+template <typename T>
+BasicInterval<T>::BasicInterval( const std::string &a, const std::string &b )
 {
-    PreciseFloat val1 = PreciseFloat( a );
-    PreciseFloat val2 = PreciseFloat( b );
+    T val1 = number_from_string<T>( a );
+    T val2 = number_from_string<T>( b );
 
-    m_interval_value = boost::numeric::interval<PreciseFloat>( std::min( val1, val2 ), std::max( val1, val2 ) );
+    m_interval_value = boost::numeric::interval<T>( std::min( val1, val2 ), std::max( val1, val2 ) );
 }
 
-Interval::Interval( const std::string &a ) : Interval( a, a ) {}
+template <typename T>
+BasicInterval<T>::BasicInterval( const std::string &a ) : BasicInterval( a, a ) {}
 
-Interval::Interval( const Interval &other ) { m_interval_value = other.m_interval_value; }
+template <typename T>
+BasicInterval<T>::BasicInterval( const BasicInterval &other ) { m_interval_value = other.m_interval_value; }
 
-PreciseFloat Interval::min() const { return m_interval_value.lower(); }
+template <typename T>
+T BasicInterval<T>::min() const { return m_interval_value.lower(); }
 
-PreciseFloat Interval::max() const { return m_interval_value.upper(); }
+template <typename T>
+T BasicInterval<T>::max() const { return m_interval_value.upper(); }
 
-long double Interval::min_as_double() const { return static_cast<long double>( min().convert_to<long double>() ); }
+template <typename T>
+long double BasicInterval<T>::min_as_double() const { return static_cast<long double>( min() ); }
 
-long double Interval::max_as_double() const { return static_cast<long double>( max().convert_to<long double>() ); }
+template <typename T>
+long double BasicInterval<T>::max_as_double() const { return static_cast<long double>( max() ); }
 
-bool Interval::is_degenerate() const { return min() == max(); }
+template <typename T>
+bool BasicInterval<T>::is_degenerate() const { return min() == max(); }
 
-bool Interval::is_empty() const
+template <typename T>
+bool BasicInterval<T>::is_empty() const
 {
     if ( boost::math::isnan( min() ) || boost::math::isnan( max() ) )
     {
@@ -54,22 +86,31 @@ bool Interval::is_empty() const
     return boost::numeric::empty( m_interval_value );
 }
 
-std::string Interval::to_string() const
+template <typename T>
+std::string BasicInterval<T>::to_string() const
 {
     std::ostringstream oss;
     oss << "[" << min() << ", " << max() << "]";
     return oss.str();
 }
 
-PreciseFloat Interval::width() const { return max() - min(); }
+template <typename T>
+T BasicInterval<T>::width() const { return max() - min(); }
 
-PreciseFloat Interval::mid_point() const { return ( min() + max() ) / PreciseFloat( 2 ); }
+template <typename T>
+T BasicInterval<T>::mid_point() const { return ( min() + max() ) / T( 2 ); }
 
-bool Interval::contains( const PreciseFloat &x ) const { return min() <= x && x <= max(); }
+template <typename T>
+bool BasicInterval<T>::contains( const T &x ) const { return min() <= x && x <= max(); }
 
-bool Interval::contains( const Interval &other ) const { return min() <= other.min() && max() >= other.max(); }
+template <typename T>
+bool BasicInterval<T>::contains( const BasicInterval &other ) const
+{
+    return min() <= other.min() && max() >= other.max();
+}
 
-bool Interval::intersects( const Interval &other ) const
+template <typename T>
+bool BasicInterval<T>::intersects( const BasicInterval &other ) const
 {
     if ( is_empty() || other.is_empty() )
         return false;
@@ -77,55 +118,62 @@ bool Interval::intersects( const Interval &other ) const
     return !( max() < other.min() || min() > other.max() );
 }
 
-Interval Interval::intersection( const Interval &other ) const
+template <typename T>
+BasicInterval<T> BasicInterval<T>::intersection( const BasicInterval &other ) const
 {
     if ( !intersects( other ) )
         throw std::domain_error( "Intervals do not intersect" );
 
-    return Interval( std::max( min(), other.min() ), std::min( max(), other.max() ) );
+    return BasicInterval( std::max( min(), other.min() ), std::min( max(), other.max() ) );
 }
 
-Interval Interval::unite( const Interval &other ) const
+template <typename T>
+BasicInterval<T> BasicInterval<T>::unite( const BasicInterval &other ) const
 {
     if ( !intersects( other ) )
         throw std::domain_error( "Intervals do not intersect, cannot construct valid union." );
 
-    return Interval( std::min( min(), other.min() ), std::max( max(), other.max() ) );
+    return BasicInterval( std::min( min(), other.min() ), std::max( max(), other.max() ) );
 }
 
-Interval Interval::union_hull( const Interval &other ) const
+template <typename T>
+BasicInterval<T> BasicInterval<T>::union_hull( const BasicInterval &other ) const
 {
     if ( is_empty() )
         return other;
     if ( other.is_empty() )
         return *this;
 
-    return Interval( std::min( min(), other.min() ), std::max( max(), other.max() ) );
+    return BasicInterval( std::min( min(), other.min() ), std::max( max(), other.max() ) );
 }
 
-Interval Interval::power( int exponent ) const
+template <typename T>
+BasicInterval<T> BasicInterval<T>::power( int exponent ) const
 {
     if ( is_empty() )
-        return Interval();
+        return BasicInterval();
 
     if ( exponent == 0 )
-        return Interval( PreciseFloat( 1 ) );
+        return BasicInterval( T( 1 ) );
 
     if ( exponent < 0 )
         throw std::domain_error( "Exponent must be non-negative for power operation" );
 
-    PreciseFloat min_power = boost::multiprecision::pow( min(), exponent );
-    PreciseFloat max_power = boost::multiprecision::pow( max(), exponent );
+    using boost::multiprecision::pow;
+    using std::pow;
 
-    PreciseFloat min_res;
-    PreciseFloat max_res;
+    T min_power = pow( min(), exponent );
+    T max_power = pow( max(), exponent );
+
+    T min_res;
+    T max_res;
 
     if ( ( exponent % 2 ) == 0 )
     {
-        if ( min() <= PreciseFloat( 0 ) && max() >= PreciseFloat( 0 ) )
+        if ( min() <= T( 0 ) && max() >= T( 0 ) )
         {
-            min_res = std::min( PreciseFloat( 0 ), std::max( min_power, max_power ) );
-            max_res = std::max( PreciseFloat( 0 ), std::max( min_power, max_power ) );
+            min_res = std::min( T( 0 ), std::max( min_power, max_power ) );
+            max_res = std::max( T( 0 ), std::max( min_power, max_power ) );
         }
         else
         {
@@ -138,98 +186,186 @@ Interval Interval::power( int exponent ) const
         min_res = std::min( min_power, max_power );
         max_res = std::max( min_power, max_power );
     }
-    return Interval( min_res, max_res );
+    return BasicInterval( min_res, max_res );
 }
 
-Interval Interval::apply_function( const std::function<PreciseFloat( const PreciseFloat & )> &func, bool monotone,
-                                   size_t number_elements ) const
+template <typename T>
+BasicInterval<T> BasicInterval<T>::apply_function( const std::function<T( const T & )> &func, bool monotone,
+                                                  size_t number_elements ) const
 {
-    if ( is_empty() )
-        return Interval();
+    return apply_function<const std::function<T( const T & )> &>( func, monotone, number_elements );
+}
 
-    if ( monotone )
+template <typename T>
+BasicInterval<T> BasicInterval<T>::operator+( const BasicInterval &other ) const
+{
+    return BasicInterval( min() + other.min(), max() + other.max() );
+}
+
+template <typename T>
+BasicInterval<T> BasicInterval<T>::operator-( const BasicInterval &other ) const
+{
+    return BasicInterval( min() - other.max(), max() - other.min() );
+}
+
+template <typename T>
+BasicInterval<T> BasicInterval<T>::operator*( const BasicInterval &other ) const
+{
+    // Multiplication by crisp number only scales the bounds, constructor swaps them for negative numbers.
+    if ( other.is_degenerate() )
+        return BasicInterval( min() * other.min(), max() * other.min() );
+    if ( is_degenerate() )
+        return BasicInterval( other.min() * min(), other.max() * min() );
+
+    Sign sign = sign_of( min(), max() );
+    Sign other_sign = sign_of( other.min(), other.max() );
+
+    switch ( sign )
     {
-        PreciseFloat val1 = func( min() );
-        PreciseFloat val2 = func( max() );
-        return Interval( std::min( val1, val2 ), std::max( val1, val2 ) );
+        case Sign::Positive:
+            switch ( other_sign )
+            {
+                case Sign::Positive:
+                    return BasicInterval( min() * other.min(), max() * other.max() );
+                case Sign::Negative:
+                    return BasicInterval( max() * other.min(), min() * other.max() );
+                case Sign::Mixed:
+                    return BasicInterval( max() * other.min(), max() * other.max() );
+            }
+            break;
+        case Sign::Negative:
+            switch ( other_sign )
+            {
+                case Sign::Positive:
+                    return BasicInterval( min() * other.max(), max() * other.min() );
+                case Sign::Negative:
+                    return BasicInterval( max() * other.max(), min() * other.min() );
+                case Sign::Mixed:
+                    return BasicInterval( min() * other.max(), min() * other.min() );
+            }
+            break;
+        case Sign::Mixed:
+            switch ( other_sign )
+            {
+                case Sign::Positive:
+                    return BasicInterval( min() * other.max(), max() * other.max() );
+                case Sign::Negative:
+                    return BasicInterval( max() * other.min(), min() * other.min() );
+                case Sign::Mixed:
+                    // Only case that needs all four products.
+                    return BasicInterval( std::min( min() * other.max(), max() * other.min() ),
+                                          std::max( min() * other.min(), max() * other.max() ) );
+            }
+            break;
     }
-    else
+
+    return BasicInterval();
+}
+
+template <typename T>
+BasicInterval<T> BasicInterval<T>::operator/( const BasicInterval &other ) const
+{
+    if ( other.contains( T( 0 ) ) )
+        throw std::domain_error( "Division by interval containing zero" );
+
+    if ( other.is_degenerate() )
+        return BasicInterval( min() / other.min(), max() / other.min() );
+
+    // Divisor does not contain zero, so it is either strictly positive or strictly negative.
+    Sign sign = sign_of( min(), max() );
+
+    if ( other.min() > T( 0 ) )
     {
-        if ( number_elements < 2 )
+        switch ( sign )
         {
-            number_elements = 2; // Ensure at least two points for a valid interval
+            case Sign::Positive:
+                return BasicInterval( min() / other.max(), max() / other.min() );
+            case Sign::Negative:
+                return BasicInterval( min() / other.min(), max() / other.max() );
+            case Sign::Mixed:
+                return BasicInterval( min() / other.min(), max() / other.min() );
         }
-
-        std::vector<PreciseFloat> values;
-        values.reserve( number_elements + 1 );
-
-        // Generate values between start and end (inclusive)
-        for ( size_t i = 0; i <= number_elements; ++i )
+    }
+    else
+    {
+        switch ( sign )
         {
-            PreciseFloat t = PreciseFloat( i ) / PreciseFloat( number_elements );
-            PreciseFloat x = min() + t * ( max() - min() );
-            values.push_back( func( x ) );
+            case Sign::Positive:
+                return BasicInterval( max() / other.max(), min() / other.min() );
+            case Sign::Negative:
+                return BasicInterval( max() / other.min(), min() / other.max() );
+            case Sign::Mixed:
+                return BasicInterval( max() / other.max(), min() / other.max() );
         }
-
-        auto minmax = std::minmax_element( values.begin(), values.end() );
-        return Interval( *minmax.first, *minmax.second );
     }
+
+    return BasicInterval();
 }
 
-Interval Interval::operator+( const Interval &other ) const
+template <typename T>
+BasicInterval<T> BasicInterval<T>::operator+( const T &value ) const
 {
-    return Interval( min() + other.min(), max() + other.max() );
+    return BasicInterval( min() + value, max() + value );
 }
 
-Interval Interval::operator-( const Interval &other ) const
+template <typename T>
+BasicInterval<T> BasicInterval<T>::operator-( const T &value ) const
 {
-    return Interval( min() - other.max(), max() - other.min() );
+    return BasicInterval( min() - value, max() - value );
 }
 
-Interval Interval::operator*( const Interval &other ) const
+template <typename T>
+BasicInterval<T> BasicInterval<T>::operator*( const T &value ) const
 {
-    std::vector<PreciseFloat> products = {
-        min() * other.min(),
-        min() * other.max(),
-        max() * other.min(),
-        max() * other.max(),
-    };
-    PreciseFloat lower = *std::min_element( products.begin(), products.end() );
-    PreciseFloat upper = *std::max_element( products.begin(), products.end() );
-    return Interval( lower, upper );
+    // Constructor swaps the bounds for negative value.
+    return BasicInterval( min() * value, max() * value );
 }
 
-Interval Interval::operator/( const Interval &other ) const
+template <typename T>
+BasicInterval<T> BasicInterval<T>::operator/( const T &value ) const
 {
-    if ( other.contains( PreciseFloat( 0 ) ) )
-        throw std::domain_error( "Division by interval containing zero" );
+    if ( value == T( 0 ) )
+        throw std::domain_error( "Division by zero" );
 
-    std::vector<PreciseFloat> products = {
-        min() / other.min(),
-        min() / other.max(),
-        max() / other.min(),
-        max() / other.max(),
-    };
-    PreciseFloat lower = *std::min_element( products.begin(), products.end() );
-    PreciseFloat upper = *std::max_element( products.begin(), products.end() );
-    return Interval( lower, upper );
+    return BasicInterval( min() / value, max() / value );
 }
 
-Interval Interval::operator-() const { return Interval( -m_interval_value.upper(), -m_interval_value.lower() ); }
+template <typename T>
+BasicInterval<T> BasicInterval<T>::operator-() const
+{
+    return BasicInterval( -m_interval_value.upper(), -m_interval_value.lower() );
+}
+
+template <typename T>
+bool BasicInterval<T>::operator==( const BasicInterval &other ) const
+{
+    return min() == other.min() && max() == other.max();
+}
 
-bool Interval::operator==( const Interval &other ) const { return min() == other.min() && max() == other.max(); }
+template <typename T>
+bool BasicInterval<T>::operator<( const BasicInterval &other ) const { return max() < other.min(); }
 
-bool Interval::operator<( const Interval &other ) const { return max() < other.min(); }
+template <typename T>
+bool BasicInterval<T>::operator>( const BasicInterval &other ) const { return min() > other.max(); }
 
-bool Interval::operator>( const Interval &other ) const { return min() > other.max(); }
+template <typename T>
+bool BasicInterval<T>::operator<( const T &other ) const { return *this < BasicInterval( other ); }
 
-bool Interval::operator<( const PreciseFloat &other ) const { return *this < Interval( other ); }
+template <typename T>
+bool BasicInterval<T>::operator>( const T &other ) const { return *this > BasicInterval( other ); }
 
-bool Interval::operator>( const PreciseFloat &other ) const { return *this > Interval( other ); }
+template <typename T>
+bool BasicInterval<T>::operator<( const std::string &other ) const { return *this < BasicInterval( other ); }
 
-bool Interval::operator<( const std::string &other ) const { return *this < Interval( other ); }
+template <typename T>
+bool BasicInterval<T>::operator>( const std::string &other ) const { return *this > BasicInterval( other ); }
 
-bool Interval::operator>( const std::string &other ) const { return *this > Interval( other ); }
+template class DLL_API FuzzyMath::BasicInterval<PreciseFloat>;
+template class DLL_API FuzzyMath::BasicInterval<double>;
+template class DLL_API FuzzyMath::BasicInterval<long double>;
+#ifdef FUZZYMATH_HAS_FLOAT128
+template class DLL_API FuzzyMath::BasicInterval<QuadFloat>;
+#endif
 
 Interval operator+( int lhs, const Interval &rhs ) { return Interval( PreciseFloat( lhs ) ) + rhs; }
 
@@ -0,0 +1,214 @@
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <stdexcept>
+
+#include "IntervalIndex.h"
+
+using namespace FuzzyMath;
+
+template <typename T>
+BasicIntervalIndex<T>::BasicIntervalIndex( std::span<const BasicFuzzyNumber<T>> numbers, std::vector<T> alpha_levels )
+    : m_levels( std::move( alpha_levels ) ), m_count( numbers.size() )
+{
+    std::sort( m_levels.begin(), m_levels.end() );
+    m_levels.erase( std::unique( m_levels.begin(), m_levels.end() ), m_levels.end() );
+
+    while ( ( size_t( 2 ) << m_height ) <= m_count )
+        ++m_height;
+
+    m_lower.resize( m_levels.size() * m_count );
+    m_upper.resize( m_levels.size() * m_count );
+    m_maximum.resize( m_levels.size() * m_count );
+    m_numbers.resize( m_levels.size() * m_count );
+
+    std::vector<T> lower( m_count );
+    std::vector<T> upper( m_count );
+    std::vector<size_t> order( m_count );
+    std::vector<T> suffix_maximum( m_count );
+
+    for ( size_t level = 0; level < m_levels.size(); ++level )
+    {
+        for ( size_t i = 0; i < m_count; ++i )
+        {
+            BasicInterval<T> cut = numbers[i].alpha_cut( m_levels[level] ).interval();
+            lower[i] = cut.min();
+            upper[i] = cut.max();
+        }
+
+        std::iota( order.begin(), order.end(), size_t( 0 ) );
+        std::stable_sort( order.begin(), order.end(), [&lower]( size_t a, size_t b ) { return lower[a] < lower[b]; } );
+
+        size_t offset = level * m_count;
+        T *level_lower = m_lower.data() + offset;
+        T *level_upper = m_upper.data() + offset;
+        T *maximum = m_maximum.data() + offset;
+
+        for ( size_t i = 0; i < m_count; ++i )
+        {
+            level_lower[i] = lower[order[i]];
+            level_upper[i] = upper[order[i]];
+            m_numbers[offset + i] = order[i];
+        }
+
+        for ( size_t i = m_count; i-- > 0; )
+        {
+            suffix_maximum[i] = i + 1 < m_count ? std::max( level_upper[i], suffix_maximum[i + 1] ) : level_upper[i];
+        }
+
+        // Leaves are even positions, nodes of height k are at odd multiples of 2^k minus one. Right subtree of the
+        // last node of a height may be cut off by the end of arrays, then it holds all cuts after the node.
+        for ( size_t i = 0; i < m_count; i += 2 )
+        {
+            maximum[i] = level_upper[i];
+        }
+
+        for ( size_t height = 1; height <= m_height; ++height )
+        {
+            size_t half = size_t( 1 ) << ( height - 1 );
+
+            for ( size_t i = ( size_t( 1 ) << height ) - 1; i < m_count; i += size_t( 4 ) * half )
+            {
+                maximum[i] = std::max( level_upper[i], maximum[i - half] );
+
+                if ( i + half < m_count )
+                    maximum[i] = std::max( maximum[i], maximum[i + half] );
+                else if ( i + 1 < m_count )
+                    maximum[i] = std::max( maximum[i], suffix_maximum[i + 1] );
+            }
+        }
+    }
+}
+
+template <typename T>
+size_t BasicIntervalIndex<T>::size() const { return m_count; }
+
+template <typename T>
+std::span<const T> BasicIntervalIndex<T>::alpha_levels() const { return m_levels; }
+
+template <typename T>
+size_t BasicIntervalIndex<T>::level_offset( const T &alpha ) const
+{
+    auto level = std::lower_bound( m_levels.begin(), m_levels.end(), alpha );
+
+    if ( level == m_levels.end() || *level != alpha )
+    {
+        throw std::invalid_argument( "Alpha level is not indexed." );
+    }
+
+    return static_cast<size_t>( level - m_levels.begin() ) * m_count;
+}
+
+template <typename T>
+template <typename F>
+void BasicIntervalIndex<T>::search( size_t offset, const T &min, const T &max, F &&report ) const
+{
+    if ( m_count == 0 )
+        return;
+
+    const T *lower = m_lower.data() + offset;
+    const T *upper = m_upper.data() + offset;
+    const T *maximum = m_maximum.data() + offset;
+
+    struct Frame
+    {
+        size_t node;
+        size_t height;
+        bool left_done;
+    };
+
+    // Path from the root holds at most two frames per height.
+    std::array<Frame, 2 * 64> stack;
+    size_t top = 0;
+    stack[top++] = Frame{ ( size_t( 1 ) << m_height ) - 1, m_height, false };
+
+    while ( top > 0 )
+    {
+        Frame frame = stack[--top];
+
+        if ( frame.height <= 3 )
+        {
+            // Small subtrees are scanned linearly, until lower bounds pass max.
+            size_t first = frame.node >> frame.height << frame.height;
+            size_t last = std::min( first + ( size_t( 2 ) << frame.height ) - 1, m_count );
+
+            for ( size_t i = first; i < last && !( max < lower[i] ); ++i )
+            {
+                if ( !( upper[i] < min ) )
+                    report( i );
+            }
+        }
+        else if ( !frame.left_done )
+        {
+            // Left subtree is skipped if none of its cuts reaches min. Past the end of arrays, it may still hold
+            // cuts, but has no maximum.
+            size_t left = frame.node - ( size_t( 1 ) << ( frame.height - 1 ) );
+            stack[top++] = Frame{ frame.node, frame.height, true };
+
+            if ( left >= m_count || !( maximum[left] < min ) )
+                stack[top++] = Frame{ left, frame.height - 1, false };
+        }
+        else if ( frame.node < m_count && !( max < lower[frame.node] ) )
+        {
+            // Cuts of the right subtree start at lower[frame.node] or later.
+            if ( !( upper[frame.node] < min ) )
+                report( frame.node );
+
+            stack[top++] = Frame{ frame.node + ( size_t( 1 ) << ( frame.height - 1 ) ), frame.height - 1, false };
+        }
+    }
+}
+
+template <typename T>
+std::vector<size_t> BasicIntervalIndex<T>::stabbing( const T &value, const T &alpha ) const
+{
+    return overlapping( BasicInterval<T>( value ), alpha );
+}
+
+template <typename T>
+std::vector<size_t> BasicIntervalIndex<T>::overlapping( const BasicInterval<T> &window, const T &alpha ) const
+{
+    size_t offset = level_offset( alpha );
+    std::vector<size_t> result;
+
+    if ( window.is_empty() )
+        return result;
+
+    search( offset, window.min(), window.max(),
+            [&]( size_t position ) { result.push_back( m_numbers[offset + position] ); } );
+
+    std::sort( result.begin(), result.end() );
+    return result;
+}
+
+template <typename T>
+std::vector<size_t> BasicIntervalIndex<T>::contained( const BasicInterval<T> &window, const T &alpha ) const
+{
+    size_t offset = level_offset( alpha );
+    std::vector<size_t> result;
+
+    if ( window.is_empty() )
+        return result;
+
+    // Cuts inside window start within it, which is a contiguous range of positions.
+    const T *lower = m_lower.data() + offset;
+    const T *upper = m_upper.data() + offset;
+    size_t first = std::lower_bound( lower, lower + m_count, window.min() ) - lower;
+    size_t last = std::upper_bound( lower, lower + m_count, window.max() ) - lower;
+
+    for ( size_t position = first; position < last; ++position )
+    {
+        if ( !( window.max() < upper[position] ) )
+            result.push_back( m_numbers[offset + position] );
+    }
+
+    std::sort( result.begin(), result.end() );
+    return result;
+}
+
+template class DLL_API FuzzyMath::BasicIntervalIndex<PreciseFloat>;
+template class DLL_API FuzzyMath::BasicIntervalIndex<double>;
+template class DLL_API FuzzyMath::BasicIntervalIndex<long double>;
+#ifdef FUZZYMATH_HAS_FLOAT128
+template class DLL_API FuzzyMath::BasicIntervalIndex<QuadFloat>;
+#endif
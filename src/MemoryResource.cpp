@@ -0,0 +1,27 @@
+#include "MemoryResource.h"
+
+using namespace FuzzyMath;
+
+namespace
+{
+    thread_local std::pmr::memory_resource *current_resource = nullptr;
+} // namespace
+
+std::pmr::memory_resource *FuzzyMath::memory_resource()
+{
+    return current_resource != nullptr ? current_resource : std::pmr::get_default_resource();
+}
+
+ScopedMemoryResource::ScopedMemoryResource( std::pmr::memory_resource *resource ) : m_previous( current_resource )
+{
+    current_resource = resource;
+}
+
+ScopedMemoryResource::~ScopedMemoryResource() { current_resource = m_previous; }
+
+ScopedArena::ScopedArena( size_t initial_size, std::pmr::memory_resource *upstream )
+    : m_buffer( initial_size, upstream ), m_scope( &m_buffer )
+{
+}
+
+std::pmr::memory_resource *ScopedArena::resource() { return &m_buffer; }
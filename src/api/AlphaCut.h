@@ -7,40 +7,61 @@
 
 namespace FuzzyMath
 {
-    class DLL_API AlphaCut
+    template <typename T>
+    class BasicAlphaCut
     {
       public:
-        AlphaCut( const PreciseFloat &alpha, const Interval &interval );
-        AlphaCut( const PreciseFloat &alpha );
+        using value_type = T;
+        using interval_type = BasicInterval<T>;
 
-        template <typename T>
-            requires( std::integral<T> || std::floating_point<T> || std::same_as<T, std::string> ||
-                      std::is_convertible_v<T, std::string> )
-        AlphaCut( const T &alpha ) : AlphaCut( PreciseFloat( alpha ) ){};
+        BasicAlphaCut( const T &alpha, const BasicInterval<T> &interval );
+        BasicAlphaCut( const T &alpha );
 
-        template <typename T>
-            requires( std::integral<T> || std::floating_point<T> || std::same_as<T, std::string> ||
-                      std::is_convertible_v<T, std::string> )
-        AlphaCut( const T &alpha, const Interval &interval ) : AlphaCut( PreciseFloat( alpha ), interval ){};
+        template <typename U>
+            requires( std::integral<U> || std::floating_point<U> || std::same_as<U, std::string> ||
+                      std::is_convertible_v<U, std::string> )
+        BasicAlphaCut( const U &alpha ) : BasicAlphaCut( to_number<T>( alpha ) ){};
 
-        std::weak_ordering operator<=>( const AlphaCut &other ) const;
-        bool operator==( const AlphaCut &other ) const;
+        template <typename U>
+            requires( std::integral<U> || std::floating_point<U> || std::same_as<U, std::string> ||
+                      std::is_convertible_v<U, std::string> )
+        BasicAlphaCut( const U &alpha, const BasicInterval<T> &interval )
+            : BasicAlphaCut( to_number<T>( alpha ), interval ){};
 
-        PreciseFloat alpha() const;
-        Interval interval() const;
+        std::weak_ordering operator<=>( const BasicAlphaCut &other ) const;
+        bool operator==( const BasicAlphaCut &other ) const;
+
+        T alpha() const;
+        BasicInterval<T> interval() const;
 
         std::string to_string() const;
 
-        bool contains( const AlphaCut &other ) const;
+        bool contains( const BasicAlphaCut &other ) const;
+
+        BasicAlphaCut operator-() const;
 
-        AlphaCut operator-() const;
+        BasicAlphaCut apply_function( const std::function<T( const T & )> &func, bool monotone = false,
+                                      size_t number_elements = 1000 ) const;
 
-        AlphaCut apply_function( const std::function<PreciseFloat( const PreciseFloat & )> &func, bool monotone = false,
-                                 size_t number_elements = 1000 ) const;
+        template <typename F>
+            requires RealFunction<F, T>
+        BasicAlphaCut apply_function( F &&func, bool monotone = false, size_t number_elements = 1000 ) const
+        {
+            return BasicAlphaCut( m_alpha, m_interval.apply_function( func, monotone, number_elements ) );
+        }
 
       private:
-        PreciseFloat m_alpha;
-        Interval m_interval;
+        T m_alpha;
+        BasicInterval<T> m_interval;
     };
 
-} // namespace FuzzyMath
\ No newline at end of file
+    using AlphaCut = BasicAlphaCut<PreciseFloat>;
+
+    extern template class DLL_API BasicAlphaCut<PreciseFloat>;
+    extern template class DLL_API BasicAlphaCut<double>;
+    extern template class DLL_API BasicAlphaCut<long double>;
+#ifdef FUZZYMATH_HAS_FLOAT128
+    extern template class DLL_API BasicAlphaCut<QuadFloat>;
+#endif
+
+} // namespace FuzzyMath
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "AlphaCut.h"
+#include "FuzzyMath.h"
+#include "FuzzyNumber.h"
+#include "Interval.h"
+#include "Types.h"
+
+namespace FuzzyMath
+{
+    // Encoding of numbers in binary data. Double stores every number as IEEE 754 double, which can be read back into
+    // any number type. Native stores numbers exactly - hardware floating point types as their bytes and PreciseFloat
+    // as the limbs, exponent, sign and class of its cpp_dec_float backend - and can only be read into the same type.
+    enum class BinaryEncoding : std::uint8_t
+    {
+        Double = 1,
+        Native = 2
+    };
+
+    // Versioned binary format for intervals, alpha cuts and fuzzy numbers. All integers are little endian.
+    //
+    // Header (20 bytes):
+    //   magic "FZMB" (4 bytes), format version (uint16), record kind (uint8), BinaryEncoding (uint8),
+    //   size of one encoded number in bytes (uint32), number of records (uint64).
+    //
+    // Records, numbers are packed one after another:
+    //   Interval    - lower, upper,
+    //   AlphaCut    - alpha, lower, upper,
+    //   FuzzyNumber - number of alpha cuts n (uint64), n alphas, n lower bounds, n upper bounds.
+    //
+    // Deserialization throws std::invalid_argument for data that is truncated, of other record kind, format version
+    // or number type, and for fuzzy numbers that fail validation.
+    template <typename T>
+    class BasicBinarySerializer
+    {
+      public:
+        static constexpr std::uint16_t format_version = 1;
+        static constexpr size_t header_size = 20;
+
+        static std::vector<std::byte> serialize( const BasicInterval<T> &interval,
+                                                 BinaryEncoding encoding = BinaryEncoding::Native );
+        static std::vector<std::byte> serialize( const BasicAlphaCut<T> &alpha_cut,
+                                                 BinaryEncoding encoding = BinaryEncoding::Native );
+        static std::vector<std::byte> serialize( const BasicFuzzyNumber<T> &fuzzy_number,
+                                                 BinaryEncoding encoding = BinaryEncoding::Native );
+
+        static std::vector<std::byte> serialize( std::span<const BasicInterval<T>> intervals,
+                                                 BinaryEncoding encoding = BinaryEncoding::Native );
+        static std::vector<std::byte> serialize( std::span<const BasicAlphaCut<T>> alpha_cuts,
+                                                 BinaryEncoding encoding = BinaryEncoding::Native );
+        static std::vector<std::byte> serialize( std::span<const BasicFuzzyNumber<T>> fuzzy_numbers,
+                                                 BinaryEncoding encoding = BinaryEncoding::Native );
+
+        // Single object, data must contain exactly one record.
+        static BasicInterval<T> deserialize_interval( std::span<const std::byte> data );
+        static BasicAlphaCut<T> deserialize_alpha_cut( std::span<const std::byte> data );
+        static BasicFuzzyNumber<T> deserialize_fuzzy_number( std::span<const std::byte> data );
+
+        static std::vector<BasicInterval<T>> deserialize_intervals( std::span<const std::byte> data );
+        static std::vector<BasicAlphaCut<T>> deserialize_alpha_cuts( std::span<const std::byte> data );
+        static std::vector<BasicFuzzyNumber<T>> deserialize_fuzzy_numbers( std::span<const std::byte> data );
+
+        // Size of one number in given encoding.
+        static size_t value_size( BinaryEncoding encoding );
+    };
+
+    using BinarySerializer = BasicBinarySerializer<PreciseFloat>;
+
+    extern template class DLL_API BasicBinarySerializer<PreciseFloat>;
+    extern template class DLL_API BasicBinarySerializer<double>;
+    extern template class DLL_API BasicBinarySerializer<long double>;
+#ifdef FUZZYMATH_HAS_FLOAT128
+    extern template class DLL_API BasicBinarySerializer<QuadFloat>;
+#endif
+} // namespace FuzzyMath
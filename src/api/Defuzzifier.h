@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "FuzzyMath.h"
+#include "FuzzyNumber.h"
+#include "FuzzyNumberBatch.h"
+#include "Interval.h"
+#include "Types.h"
+
+namespace FuzzyMath
+{
+    enum class DefuzzificationMethod : std::uint8_t
+    {
+        // Centre of gravity of the area under membership function.
+        Centroid,
+        // Point splitting the area under membership function in halves.
+        Bisector,
+        // Midpoint of the kernel.
+        MeanOfMaxima,
+        // Midpoint of the expected interval.
+        ExpectedValue,
+        // Graded mean integration, average of alpha cut midpoints weighted by alpha.
+        GradedMean
+    };
+
+    // Defuzzification of fuzzy numbers. Membership function is linear between stored alpha cuts, so all methods are
+    // evaluated exactly by integrating over consecutive alpha levels, without sampling. Centroid and bisector of a
+    // fuzzy number without area, such as a crisp number, are the midpoint of its kernel.
+    template <typename T>
+    class BasicDefuzzifier
+    {
+      public:
+        static T centroid( const BasicFuzzyNumber<T> &number );
+        static T bisector( const BasicFuzzyNumber<T> &number );
+        static T mean_of_maxima( const BasicFuzzyNumber<T> &number );
+
+        // Integrals of lower and upper bounds of alpha cuts over alpha, and midpoint of the resulting interval.
+        static BasicInterval<T> expected_interval( const BasicFuzzyNumber<T> &number );
+        static T expected_value( const BasicFuzzyNumber<T> &number );
+
+        static T graded_mean( const BasicFuzzyNumber<T> &number );
+
+        static T defuzzify( const BasicFuzzyNumber<T> &number, DefuzzificationMethod method );
+
+        // One value per fuzzy number, in the same order. Batch has its own name, since a vector of fuzzy numbers
+        // converts implicitly to both a span and a batch.
+        static std::vector<T> defuzzify( std::span<const BasicFuzzyNumber<T>> numbers, DefuzzificationMethod method );
+        static std::vector<T> defuzzify_batch( const BasicFuzzyNumberBatch<T> &batch, DefuzzificationMethod method );
+    };
+
+    using Defuzzifier = BasicDefuzzifier<PreciseFloat>;
+
+    extern template class DLL_API BasicDefuzzifier<PreciseFloat>;
+    extern template class DLL_API BasicDefuzzifier<double>;
+    extern template class DLL_API BasicDefuzzifier<long double>;
+#ifdef FUZZYMATH_HAS_FLOAT128
+    extern template class DLL_API BasicDefuzzifier<QuadFloat>;
+#endif
+} // namespace FuzzyMath
@@ -0,0 +1,216 @@
+#pragma once
+
+#include <algorithm>
+#include <future>
+#include <initializer_list>
+#include <memory_resource>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "AlphaCut.h"
+#include "FuzzyNumber.h"
+#include "Interval.h"
+#include "MemoryResource.h"
+#include "Types.h"
+
+namespace FuzzyMath
+{
+    // Extension principle for function of several fuzzy arguments, evaluated over the union of their alpha levels. At
+    // every alpha level func is evaluated at all vertices of the box formed by alpha cuts of arguments, which gives the
+    // exact result if func is monotone in each argument. Otherwise number_elements additional points of a Halton
+    // sequence inside the box are sampled as well. Vertices and samples of all alpha levels are split between
+    // number_of_threads threads (zero uses std::thread::hardware_concurrency()), so func must be safe to call
+    // concurrently.
+    template <typename T, typename F>
+        requires MultivariateRealFunction<F, T>
+    BasicFuzzyNumber<T> apply_function( F &&func, const std::vector<BasicFuzzyNumber<T>> &arguments,
+                                        bool monotone = false, size_t number_elements = 1000,
+                                        size_t number_of_threads = 0 )
+    {
+        FUZZYMATH_TIME( ApplyFunction );
+
+        size_t dimension = arguments.size();
+
+        if ( dimension == 0 )
+        {
+            throw std::invalid_argument( "Function needs at least one fuzzy argument." );
+        }
+
+        if ( dimension >= 32 )
+        {
+            throw std::invalid_argument( "Vertex method supports at most 31 fuzzy arguments." );
+        }
+
+        // Temporaries are allocated from memory resource of the thread that uses them.
+        std::pmr::vector<T> alphas( memory_resource() );
+
+        for ( const BasicFuzzyNumber<T> &argument : arguments )
+        {
+            std::span<const T> levels = argument.alpha_levels();
+            alphas.insert( alphas.end(), levels.begin(), levels.end() );
+        }
+
+        std::sort( alphas.begin(), alphas.end() );
+        alphas.erase( std::unique( alphas.begin(), alphas.end() ), alphas.end() );
+
+        // Boxes of alpha cuts of arguments, row per alpha level.
+        std::pmr::vector<BasicInterval<T>> boxes( memory_resource() );
+        boxes.reserve( alphas.size() * dimension );
+
+        for ( const T &alpha : alphas )
+        {
+            for ( const BasicFuzzyNumber<T> &argument : arguments )
+            {
+                boxes.push_back( argument.alpha_cut( alpha ).interval() );
+            }
+        }
+
+        size_t number_vertices = size_t( 1 ) << dimension;
+        size_t number_samples = number_vertices + ( monotone ? 0 : number_elements );
+        size_t number_points = alphas.size() * number_samples;
+        FUZZYMATH_COUNT( FunctionSamples, number_points );
+
+        // Primes used as bases of Halton sequence, one per argument.
+        std::vector<size_t> bases;
+
+        for ( size_t candidate = 2; bases.size() < dimension; ++candidate )
+        {
+            if ( std::none_of( bases.begin(), bases.end(), [candidate]( size_t p ) { return candidate % p == 0; } ) )
+            {
+                bases.push_back( candidate );
+            }
+        }
+
+        struct Range
+        {
+            std::pmr::vector<T> lower;
+            std::pmr::vector<T> upper;
+            std::pmr::vector<bool> evaluated;
+        };
+
+        // Range of func at points first to last (exclusive), points are numbered by alpha level and then by sample.
+        auto evaluate = [&]( size_t first, size_t last ) -> Range
+        {
+            std::pmr::memory_resource *resource = memory_resource();
+            Range range{ std::pmr::vector<T>( alphas.size(), resource ), std::pmr::vector<T>( alphas.size(), resource ),
+                         std::pmr::vector<bool>( alphas.size(), false, resource ) };
+            std::pmr::vector<T> point( dimension, resource );
+
+            for ( size_t index = first; index < last; ++index )
+            {
+                size_t level = index / number_samples;
+                size_t sample = index % number_samples;
+                const BasicInterval<T> *box = &boxes[level * dimension];
+
+                for ( size_t d = 0; d < dimension; ++d )
+                {
+                    if ( sample < number_vertices )
+                    {
+                        point[d] = ( sample >> d ) & 1 ? box[d].max() : box[d].min();
+                    }
+                    else
+                    {
+                        // Radical inverse of sample number in base of the argument.
+                        T position = T( 0 );
+                        T scale = T( 1 );
+
+                        for ( size_t k = sample - number_vertices + 1; k > 0; k /= bases[d] )
+                        {
+                            scale /= T( bases[d] );
+                            position += scale * T( k % bases[d] );
+                        }
+
+                        point[d] = box[d].min() + position * ( box[d].max() - box[d].min() );
+                    }
+                }
+
+                T value = func( std::span<const T>( point ) );
+
+                if ( !range.evaluated[level] )
+                {
+                    range.lower[level] = value;
+                    range.upper[level] = value;
+                    range.evaluated[level] = true;
+                }
+                else
+                {
+                    range.lower[level] = std::min( range.lower[level], value );
+                    range.upper[level] = std::max( range.upper[level], value );
+                }
+            }
+
+            return range;
+        };
+
+        if ( number_of_threads == 0 )
+        {
+            number_of_threads = std::max( std::thread::hardware_concurrency(), 1u );
+        }
+
+        size_t number_chunks = std::min( number_of_threads, number_points );
+        size_t chunk_size = number_points / number_chunks;
+        size_t remainder = number_points % number_chunks;
+
+        auto chunk_start = [chunk_size, remainder]( size_t chunk )
+        { return chunk * chunk_size + std::min( chunk, remainder ); };
+
+        // First chunk is evaluated on the calling thread, others asynchronously.
+        std::pmr::vector<std::future<Range>> chunks( memory_resource() );
+        chunks.reserve( number_chunks - 1 );
+
+        for ( size_t chunk = 1; chunk < number_chunks; ++chunk )
+        {
+            chunks.push_back(
+                std::async( std::launch::async, evaluate, chunk_start( chunk ), chunk_start( chunk + 1 ) ) );
+        }
+
+        Range result = evaluate( 0, chunk_start( 1 ) );
+
+        // Chunks are reduced in order, so the first exception by point order is the one rethrown.
+        for ( std::future<Range> &chunk : chunks )
+        {
+            Range range = chunk.get();
+
+            for ( size_t level = 0; level < alphas.size(); ++level )
+            {
+                if ( !range.evaluated[level] )
+                    continue;
+
+                if ( !result.evaluated[level] )
+                {
+                    result.lower[level] = range.lower[level];
+                    result.upper[level] = range.upper[level];
+                    result.evaluated[level] = true;
+                }
+                else
+                {
+                    result.lower[level] = std::min( result.lower[level], range.lower[level] );
+                    result.upper[level] = std::max( result.upper[level], range.upper[level] );
+                }
+            }
+        }
+
+        // Sampled ranges of neighbouring alpha levels are not nested in general, the image of a lower cut must contain
+        // the image of the one above it.
+        for ( size_t level = alphas.size() - 1; level-- > 0; )
+        {
+            result.lower[level] = std::min( result.lower[level], result.lower[level + 1] );
+            result.upper[level] = std::max( result.upper[level], result.upper[level + 1] );
+        }
+
+        return BasicFuzzyNumber<T>( std::move( alphas ), std::move( result.lower ), std::move( result.upper ) );
+    }
+
+    template <typename T, typename F>
+        requires MultivariateRealFunction<F, T>
+    BasicFuzzyNumber<T> apply_function( F &&func, std::initializer_list<BasicFuzzyNumber<T>> arguments,
+                                        bool monotone = false, size_t number_elements = 1000,
+                                        size_t number_of_threads = 0 )
+    {
+        return apply_function( std::forward<F>( func ), std::vector<BasicFuzzyNumber<T>>( arguments ), monotone,
+                               number_elements, number_of_threads );
+    }
+
+} // namespace FuzzyMath
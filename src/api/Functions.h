@@ -4,6 +4,7 @@
 #include <string>
 
 #include "AlphaCut.h"
+#include "ExtensionPrinciple.h"
 #include "FuzzyMembership.h"
 #include "FuzzyNumber.h"
 #include "FuzzyNumberFactory.h"
@@ -14,144 +15,175 @@ using namespace FuzzyMath;
 
 // FuzzyNumbers
 
-std::ostream &operator<<( std::ostream &os, const FuzzyMath::FuzzyNumber &fn );
-
 template <typename T>
-    requires( std::integral<T> || std::floating_point<T> || std::same_as<T, std::string> ||
-              std::is_convertible_v<T, std::string> )
-FuzzyNumber operator+( const FuzzyNumber &lhs, T rhs )
+std::ostream &operator<<( std::ostream &os, const BasicFuzzyNumber<T> &fn )
 {
-    return lhs + FuzzyNumberFactory::crisp_number( PreciseFloat( rhs ) );
+    os << fn.to_descriptive_string();
+    return os;
 }
 
-template <typename T>
-    requires( std::integral<T> || std::floating_point<T> || std::same_as<T, std::string> ||
-              std::is_convertible_v<T, std::string> )
-FuzzyNumber operator-( const FuzzyNumber &lhs, T rhs )
+template <typename E>
+    requires FuzzyExpressionNode<E>
+std::ostream &operator<<( std::ostream &os, const E &expression )
 {
-    return lhs - FuzzyNumberFactory::crisp_number( PreciseFloat( rhs ) );
+    os << expression.evaluate().to_descriptive_string();
+    return os;
 }
 
-template <typename T>
-    requires( std::integral<T> || std::floating_point<T> || std::same_as<T, std::string> ||
-              std::is_convertible_v<T, std::string> )
-FuzzyNumber operator*( const FuzzyNumber &lhs, T rhs )
+template <typename E, typename U>
+    requires( FuzzyOperand<E> && ( std::integral<U> || std::floating_point<U> || std::same_as<U, std::string> ||
+                                   std::is_convertible_v<U, std::string> ) )
+auto operator+( E &&lhs, U rhs )
 {
-    return lhs * FuzzyNumberFactory::crisp_number( PreciseFloat( rhs ) );
+    using T = typename std::remove_cvref_t<E>::value_type;
+    return make_fuzzy_scalar_expression<std::plus<>>( std::forward<E>( lhs ), to_number<T>( rhs ) );
 }
 
-template <typename T>
-    requires( std::integral<T> || std::floating_point<T> || std::same_as<T, std::string> ||
-              std::is_convertible_v<T, std::string> )
-FuzzyNumber operator/( const FuzzyNumber &lhs, T rhs )
+template <typename E, typename U>
+    requires( FuzzyOperand<E> && ( std::integral<U> || std::floating_point<U> || std::same_as<U, std::string> ||
+                                   std::is_convertible_v<U, std::string> ) )
+auto operator-( E &&lhs, U rhs )
 {
-    return lhs / FuzzyNumberFactory::crisp_number( PreciseFloat( rhs ) );
+    using T = typename std::remove_cvref_t<E>::value_type;
+    return make_fuzzy_scalar_expression<std::minus<>>( std::forward<E>( lhs ), to_number<T>( rhs ) );
 }
 
-template <typename T>
-    requires( std::integral<T> || std::floating_point<T> || std::same_as<T, std::string> ||
-              std::is_convertible_v<T, std::string> )
-FuzzyNumber operator+( T lhs, const FuzzyNumber &rhs )
+template <typename E, typename U>
+    requires( FuzzyOperand<E> && ( std::integral<U> || std::floating_point<U> || std::same_as<U, std::string> ||
+                                   std::is_convertible_v<U, std::string> ) )
+auto operator*( E &&lhs, U rhs )
 {
-    return FuzzyNumberFactory::crisp_number( PreciseFloat( lhs ) ) + rhs;
+    using T = typename std::remove_cvref_t<E>::value_type;
+    return make_fuzzy_scalar_expression<std::multiplies<>>( std::forward<E>( lhs ), to_number<T>( rhs ) );
 }
 
-template <typename T>
-    requires( std::integral<T> || std::floating_point<T> || std::same_as<T, std::string> ||
-              std::is_convertible_v<T, std::string> )
-FuzzyNumber operator-( T lhs, const FuzzyNumber &rhs )
+template <typename E, typename U>
+    requires( FuzzyOperand<E> && ( std::integral<U> || std::floating_point<U> || std::same_as<U, std::string> ||
+                                   std::is_convertible_v<U, std::string> ) )
+auto operator/( E &&lhs, U rhs )
 {
-    return FuzzyNumberFactory::crisp_number( PreciseFloat( lhs ) ) - rhs;
+    using T = typename std::remove_cvref_t<E>::value_type;
+    return make_fuzzy_scalar_expression<std::divides<>>( std::forward<E>( lhs ), to_number<T>( rhs ) );
 }
 
-template <typename T>
-    requires( std::integral<T> || std::floating_point<T> || std::same_as<T, std::string> ||
-              std::is_convertible_v<T, std::string> )
-FuzzyNumber operator*( T lhs, const FuzzyNumber &rhs )
+template <typename E, typename U>
+    requires( FuzzyOperand<E> && ( std::integral<U> || std::floating_point<U> || std::same_as<U, std::string> ||
+                                   std::is_convertible_v<U, std::string> ) )
+auto operator+( U lhs, E &&rhs )
 {
-    return FuzzyNumberFactory::crisp_number( PreciseFloat( lhs ) ) * rhs;
+    using T = typename std::remove_cvref_t<E>::value_type;
+    return make_fuzzy_scalar_expression<std::plus<>>( std::forward<E>( rhs ), to_number<T>( lhs ) );
 }
 
-template <typename T>
-    requires( std::integral<T> || std::floating_point<T> || std::same_as<T, std::string> ||
-              std::is_convertible_v<T, std::string> )
-FuzzyNumber operator/( T lhs, const FuzzyNumber &rhs )
+template <typename E, typename U>
+    requires( FuzzyOperand<E> && ( std::integral<U> || std::floating_point<U> || std::same_as<U, std::string> ||
+                                   std::is_convertible_v<U, std::string> ) )
+auto operator-( U lhs, E &&rhs )
 {
-    return FuzzyNumberFactory::crisp_number( PreciseFloat( lhs ) ) / rhs;
+    using T = typename std::remove_cvref_t<E>::value_type;
+    return make_fuzzy_scalar_expression<ReverseMinus>( std::forward<E>( rhs ), to_number<T>( lhs ) );
 }
 
-// Interval
+template <typename E, typename U>
+    requires( FuzzyOperand<E> && ( std::integral<U> || std::floating_point<U> || std::same_as<U, std::string> ||
+                                   std::is_convertible_v<U, std::string> ) )
+auto operator*( U lhs, E &&rhs )
+{
+    using T = typename std::remove_cvref_t<E>::value_type;
+    return make_fuzzy_scalar_expression<std::multiplies<>>( std::forward<E>( rhs ), to_number<T>( lhs ) );
+}
+
+template <typename E, typename U>
+    requires( FuzzyOperand<E> && ( std::integral<U> || std::floating_point<U> || std::same_as<U, std::string> ||
+                                   std::is_convertible_v<U, std::string> ) )
+auto operator/( U lhs, E &&rhs )
+{
+    using T = typename std::remove_cvref_t<E>::value_type;
+    return make_fuzzy_scalar_expression<ReverseDivides>( std::forward<E>( rhs ), to_number<T>( lhs ) );
+}
 
-std::ostream &operator<<( std::ostream &os, const Interval &i );
+// Interval
 
 template <typename T>
-    requires( std::integral<T> || std::floating_point<T> || std::same_as<T, std::string> ||
-              std::is_convertible_v<T, std::string> )
-Interval operator+( T lhs, const Interval &rhs )
+std::ostream &operator<<( std::ostream &os, const BasicInterval<T> &i )
 {
-    return Interval( PreciseFloat( lhs ) ) + rhs;
+    os << i.to_string();
+    return os;
 }
 
-template <typename T>
-    requires( std::integral<T> || std::floating_point<T> || std::same_as<T, std::string> ||
-              std::is_convertible_v<T, std::string> )
-Interval operator-( T lhs, const Interval &rhs )
+template <typename T, typename U>
+    requires( std::integral<U> || std::floating_point<U> || std::same_as<U, std::string> ||
+              std::is_convertible_v<U, std::string> )
+BasicInterval<T> operator+( U lhs, const BasicInterval<T> &rhs )
 {
-    return Interval( PreciseFloat( lhs ) ) - rhs;
+    return rhs + to_number<T>( lhs );
 }
 
-template <typename T>
-    requires( std::integral<T> || std::floating_point<T> || std::same_as<T, std::string> ||
-              std::is_convertible_v<T, std::string> )
-Interval operator*( T lhs, const Interval &rhs )
+template <typename T, typename U>
+    requires( std::integral<U> || std::floating_point<U> || std::same_as<U, std::string> ||
+              std::is_convertible_v<U, std::string> )
+BasicInterval<T> operator-( U lhs, const BasicInterval<T> &rhs )
 {
-    return Interval( PreciseFloat( lhs ) ) * rhs;
+    return -rhs + to_number<T>( lhs );
 }
 
-template <typename T>
-    requires( std::integral<T> || std::floating_point<T> || std::same_as<T, std::string> ||
-              std::is_convertible_v<T, std::string> )
-Interval operator/( T lhs, const Interval &rhs )
+template <typename T, typename U>
+    requires( std::integral<U> || std::floating_point<U> || std::same_as<U, std::string> ||
+              std::is_convertible_v<U, std::string> )
+BasicInterval<T> operator*( U lhs, const BasicInterval<T> &rhs )
 {
-    return Interval( PreciseFloat( lhs ) ) / rhs;
+    return rhs * to_number<T>( lhs );
 }
 
-template <typename T>
-    requires( std::integral<T> || std::floating_point<T> || std::same_as<T, std::string> ||
-              std::is_convertible_v<T, std::string> )
-Interval operator+( const Interval &lhs, T rhs )
+template <typename T, typename U>
+    requires( std::integral<U> || std::floating_point<U> || std::same_as<U, std::string> ||
+              std::is_convertible_v<U, std::string> )
+BasicInterval<T> operator/( U lhs, const BasicInterval<T> &rhs )
+{
+    return BasicInterval<T>( to_number<T>( lhs ) ) / rhs;
+}
+
+template <typename T, typename U>
+    requires( std::integral<U> || std::floating_point<U> || std::same_as<U, std::string> ||
+              std::is_convertible_v<U, std::string> )
+BasicInterval<T> operator+( const BasicInterval<T> &lhs, U rhs )
 
 {
-    return lhs + Interval( PreciseFloat( rhs ) );
+    return lhs + to_number<T>( rhs );
 }
 
-template <typename T>
-    requires( std::integral<T> || std::floating_point<T> || std::same_as<T, std::string> ||
-              std::is_convertible_v<T, std::string> )
-Interval operator-( const Interval &lhs, T rhs )
+template <typename T, typename U>
+    requires( std::integral<U> || std::floating_point<U> || std::same_as<U, std::string> ||
+              std::is_convertible_v<U, std::string> )
+BasicInterval<T> operator-( const BasicInterval<T> &lhs, U rhs )
 {
-    return lhs - Interval( PreciseFloat( rhs ) );
+    return lhs - to_number<T>( rhs );
 }
 
-template <typename T>
-    requires( std::integral<T> || std::floating_point<T> || std::same_as<T, std::string> ||
-              std::is_convertible_v<T, std::string> )
-Interval operator*( const Interval &lhs, T rhs )
+template <typename T, typename U>
+    requires( std::integral<U> || std::floating_point<U> || std::same_as<U, std::string> ||
+              std::is_convertible_v<U, std::string> )
+BasicInterval<T> operator*( const BasicInterval<T> &lhs, U rhs )
 {
-    return lhs * Interval( PreciseFloat( rhs ) );
+    return lhs * to_number<T>( rhs );
 }
 
-template <typename T>
-    requires( std::integral<T> || std::floating_point<T> || std::same_as<T, std::string> ||
-              std::is_convertible_v<T, std::string> )
-Interval operator/( const Interval &lhs, T rhs )
+template <typename T, typename U>
+    requires( std::integral<U> || std::floating_point<U> || std::same_as<U, std::string> ||
+              std::is_convertible_v<U, std::string> )
+BasicInterval<T> operator/( const BasicInterval<T> &lhs, U rhs )
 {
-    return lhs / Interval( PreciseFloat( rhs ) );
+    return lhs / to_number<T>( rhs );
 }
 
 // AlphaCut
 
-std::ostream &operator<<( std::ostream &os, const AlphaCut &ac );
+template <typename T>
+std::ostream &operator<<( std::ostream &os, const BasicAlphaCut<T> &ac )
+{
+    os << ac.to_string();
+    return os;
+}
 
 // FuzzyMembership
 
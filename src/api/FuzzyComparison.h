@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "FuzzyMath.h"
+#include "FuzzyNumber.h"
+#include "PossibilisticMembership.h"
+#include "Types.h"
+
+namespace FuzzyMath
+{
+    enum class Dominance : std::uint8_t
+    {
+        // a >= b, possibility and necessity of dominance (PD and ND).
+        GreaterOrEqual,
+        // a > b, possibility and necessity of strict dominance (PSD and NSD).
+        Greater
+    };
+
+    // Dubois-Prade indices of ranking fuzzy numbers. Possibility of a >= b is the highest alpha at which the upper
+    // bound of a is not below the lower bound of b, necessity is one minus the highest alpha at which a may still lie
+    // below b. Indices are computed exactly for piecewise linear branches, by one merged pass over alpha levels of
+    // both numbers.
+    template <typename T>
+    class BasicFuzzyComparison
+    {
+      public:
+        static PossibilisticMembership greater_or_equal( const BasicFuzzyNumber<T> &a, const BasicFuzzyNumber<T> &b );
+        static PossibilisticMembership greater( const BasicFuzzyNumber<T> &a, const BasicFuzzyNumber<T> &b );
+        static PossibilisticMembership compare( const BasicFuzzyNumber<T> &a, const BasicFuzzyNumber<T> &b,
+                                                Dominance relation );
+
+        // Row-major matrix of size numbers x numbers, element (i, j) compares numbers[i] with numbers[j]. Pairs with
+        // disjoint supports are decided without looking at their alpha cuts. Blocks of rows are computed on
+        // number_of_threads threads, zero uses std::thread::hardware_concurrency().
+        static std::vector<PossibilisticMembership> dominance_matrix( std::span<const BasicFuzzyNumber<T>> numbers,
+                                                                      Dominance relation = Dominance::GreaterOrEqual,
+                                                                      size_t number_of_threads = 0 );
+    };
+
+    using FuzzyComparison = BasicFuzzyComparison<PreciseFloat>;
+
+    extern template class DLL_API BasicFuzzyComparison<PreciseFloat>;
+    extern template class DLL_API BasicFuzzyComparison<double>;
+    extern template class DLL_API BasicFuzzyComparison<long double>;
+#ifdef FUZZYMATH_HAS_FLOAT128
+    extern template class DLL_API BasicFuzzyComparison<QuadFloat>;
+#endif
+} // namespace FuzzyMath
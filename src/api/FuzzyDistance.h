@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdint>
+
+#include "FuzzyMath.h"
+#include "FuzzyNumber.h"
+#include "Types.h"
+
+namespace FuzzyMath
+{
+    enum class DistanceMetric : std::uint8_t
+    {
+        // Supremum over alpha of Hausdorff distance of alpha cuts.
+        Hausdorff,
+        // Square root of the integral over alpha of squared differences of lower and upper bounds.
+        L2,
+        // Bertoluzza distance with uniform weights, square root of the integral over alpha of squared difference of
+        // midpoints plus theta times squared difference of spreads (half widths) of alpha cuts.
+        Bertoluzza
+    };
+
+    // Distances of fuzzy numbers. Bounds of alpha cuts are linear between stored alpha levels, so the distances are
+    // evaluated exactly in one linear merge over alpha levels of both numbers. All of them are metrics.
+    template <typename T>
+    class BasicFuzzyDistance
+    {
+      public:
+        static T hausdorff( const BasicFuzzyNumber<T> &a, const BasicFuzzyNumber<T> &b );
+        static T l2( const BasicFuzzyNumber<T> &a, const BasicFuzzyNumber<T> &b );
+
+        // Theta 1/3 corresponds to bounds weighted uniformly along every alpha cut.
+        static T bertoluzza( const BasicFuzzyNumber<T> &a, const BasicFuzzyNumber<T> &b, const T &theta = T( 1 ) / 3 );
+
+        static T distance( const BasicFuzzyNumber<T> &a, const BasicFuzzyNumber<T> &b, DistanceMetric metric );
+    };
+
+    using FuzzyDistance = BasicFuzzyDistance<PreciseFloat>;
+
+    extern template class DLL_API BasicFuzzyDistance<PreciseFloat>;
+    extern template class DLL_API BasicFuzzyDistance<double>;
+    extern template class DLL_API BasicFuzzyDistance<long double>;
+#ifdef FUZZYMATH_HAS_FLOAT128
+    extern template class DLL_API BasicFuzzyDistance<QuadFloat>;
+#endif
+} // namespace FuzzyMath
@@ -2,62 +2,652 @@
 
 #include <algorithm>
 #include <concepts>
+#include <functional>
+#include <iterator>
 #include <map>
+#include <memory_resource>
+#include <optional>
 #include <ostream>
 #include <set>
+#include <span>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #include "AlphaCut.h"
 #include "FuzzyMath.h"
+#include "FuzzyMembership.h"
 #include "Interval.h"
+#include "MemoryResource.h"
 
 using namespace FuzzyMath;
 
 namespace FuzzyMath
 {
+    // Tag of constructors taking alpha cuts that are valid by construction, such as results of arithmetic, which skip
+    // their validation.
+    struct AlreadyValidated
+    {
+        explicit AlreadyValidated() = default;
+    };
+
+    inline constexpr AlreadyValidated already_validated{};
 
-    class DLL_API FuzzyNumber
+    template <typename T>
+    class BasicFuzzyNumber
     {
       public:
-        FuzzyNumber( const std::set<AlphaCut> &alpha_cuts );
+        using value_type = T;
+        using interval_type = BasicInterval<T>;
+        using alpha_cut_type = BasicAlphaCut<T>;
+        // Column of alpha cuts, allocated from memory_resource() of the constructing thread.
+        using storage_type = std::pmr::vector<T>;
+
+        // Read-only random access iterator over alpha cuts, ordered by alpha. Alpha cuts are assembled from the
+        // columns on dereference, so the iterator yields them by value.
+        class const_iterator
+        {
+          public:
+            using iterator_concept = std::random_access_iterator_tag;
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = BasicAlphaCut<T>;
+            using difference_type = std::ptrdiff_t;
+            using reference = BasicAlphaCut<T>;
+
+            const_iterator() = default;
+            const_iterator( const BasicFuzzyNumber *number, size_t index ) : m_number( number ), m_index( index ) {}
+
+            reference operator*() const { return m_number->cut_at( m_index ); }
+            reference operator[]( difference_type n ) const { return m_number->cut_at( m_index + n ); }
+
+            const_iterator &operator++()
+            {
+                ++m_index;
+                return *this;
+            }
+
+            const_iterator operator++( int )
+            {
+                const_iterator previous = *this;
+                ++m_index;
+                return previous;
+            }
+
+            const_iterator &operator--()
+            {
+                --m_index;
+                return *this;
+            }
+
+            const_iterator operator--( int )
+            {
+                const_iterator previous = *this;
+                --m_index;
+                return previous;
+            }
+
+            const_iterator &operator+=( difference_type n )
+            {
+                m_index += n;
+                return *this;
+            }
+
+            const_iterator &operator-=( difference_type n )
+            {
+                m_index -= n;
+                return *this;
+            }
+
+            friend const_iterator operator+( const_iterator it, difference_type n ) { return it += n; }
+            friend const_iterator operator+( difference_type n, const_iterator it ) { return it += n; }
+            friend const_iterator operator-( const_iterator it, difference_type n ) { return it -= n; }
+
+            friend difference_type operator-( const const_iterator &a, const const_iterator &b )
+            {
+                return static_cast<difference_type>( a.m_index ) - static_cast<difference_type>( b.m_index );
+            }
+
+            bool operator==( const const_iterator &other ) const { return m_index == other.m_index; }
+            auto operator<=>( const const_iterator &other ) const { return m_index <=> other.m_index; }
+
+          private:
+            const BasicFuzzyNumber *m_number = nullptr;
+            size_t m_index = 0;
+        };
+
+        BasicFuzzyNumber( const std::set<BasicAlphaCut<T>> &alpha_cuts );
+
+        // Columns of alpha cuts - alpha values in ascending order, lower and upper bounds. Columns allocated from
+        // memory_resource() are moved in, others are copied into it.
+        BasicFuzzyNumber( storage_type alphas, storage_type lower, storage_type upper );
+        BasicFuzzyNumber( AlreadyValidated, storage_type alphas, storage_type lower, storage_type upper );
+
+        template <typename A>
+            requires( !std::same_as<A, std::pmr::polymorphic_allocator<T>> )
+        BasicFuzzyNumber( const std::vector<T, A> &alphas, const std::vector<T, A> &lower,
+                          const std::vector<T, A> &upper )
+            : BasicFuzzyNumber( storage_type( alphas.begin(), alphas.end(), memory_resource() ),
+                                storage_type( lower.begin(), lower.end(), memory_resource() ),
+                                storage_type( upper.begin(), upper.end(), memory_resource() ) )
+        {
+        }
+
+        template <typename A>
+            requires( !std::same_as<A, std::pmr::polymorphic_allocator<T>> )
+        BasicFuzzyNumber( AlreadyValidated, const std::vector<T, A> &alphas, const std::vector<T, A> &lower,
+                          const std::vector<T, A> &upper )
+            : BasicFuzzyNumber( already_validated, storage_type( alphas.begin(), alphas.end(), memory_resource() ),
+                                storage_type( lower.begin(), lower.end(), memory_resource() ),
+                                storage_type( upper.begin(), upper.end(), memory_resource() ) )
+        {
+        }
 
         size_t size() const;
-        const AlphaCut alpha_cut( const PreciseFloat &alpha ) const;
-        PreciseFloat min() const;
-        PreciseFloat max() const;
-        Interval support() const;
-        Interval kernel() const;
-        PreciseFloat kernel_min() const;
-        PreciseFloat kernel_max() const;
+        const BasicAlphaCut<T> alpha_cut( const T &alpha ) const;
+        BasicAlphaCut<T> cut_at( size_t index ) const;
+
+        const_iterator begin() const;
+        const_iterator end() const;
+
+        // Columns of alpha cuts - alpha values, lower and upper bounds, ordered by alpha.
+        std::span<const T> alpha_levels() const;
+        std::span<const T> lower_bounds() const;
+        std::span<const T> upper_bounds() const;
+
+        T min() const;
+        T max() const;
+        BasicInterval<T> support() const;
+        BasicInterval<T> kernel() const;
+        T kernel_min() const;
+        T kernel_max() const;
 
-        std::vector<PreciseFloat> alphas() const;
+        std::vector<T> alphas() const;
 
-        static std::vector<PreciseFloat> alpha_cut_values( size_t number_of_cuts = 2 );
+        static std::vector<T> alpha_cut_values( size_t number_of_cuts = 2 );
 
         const std::string to_string() const;
         const std::string to_descriptive_string() const;
 
-        FuzzyNumber apply_function( const std::function<PreciseFloat( const PreciseFloat & )> &func,
-                                    bool monotone = false, size_t number_elements = 1000 ) const;
+        BasicFuzzyNumber apply_function( const std::function<T( const T & )> &func, bool monotone = false,
+                                         size_t number_elements = 1000 ) const;
+
+        template <typename F>
+            requires RealFunction<F, T>
+        BasicFuzzyNumber apply_function( F &&func, bool monotone = false, size_t number_elements = 1000 ) const;
+
+        // Guaranteed enclosures of func on every alpha cut, see BasicInterval::apply_function_bounded and
+        // BasicInterval::apply_function_lipschitz. Lower cuts are widened where needed to keep alpha cuts nested.
+        template <typename F, typename E>
+            requires RealFunction<F, T> && IntervalExtension<E, T>
+        BasicFuzzyNumber apply_function_bounded( F &&func, E &&extension, const T &tolerance,
+                                                 size_t max_iterations = 1000 ) const;
+
+        template <typename F>
+            requires RealFunction<F, T>
+        BasicFuzzyNumber apply_function_lipschitz( F &&func, const T &lipschitz_constant, const T &tolerance,
+                                                   size_t max_iterations = 1000 ) const;
+
+        // Fuzzy number without interior alpha cuts whose bounds are within tolerance of linear interpolation between
+        // the remaining cuts (Douglas-Peucker on both bounds at once). Cuts at alpha 0 and 1 are always kept, so the
+        // result stays nested, and its alpha_cut differs from the original by at most tolerance at every alpha.
+        // Throws std::invalid_argument for negative tolerance.
+        BasicFuzzyNumber simplify( const T &tolerance ) const;
+
+        // Tolerance of simplify() applied to every result of arithmetic and apply_function computed on the calling
+        // thread, nullopt (default) switches automatic simplification off.
+        static void set_auto_simplify( std::optional<T> tolerance );
+        static std::optional<T> auto_simplify();
 
         // Arithmetic
-        FuzzyNumber operator-() const;
-        FuzzyNumber operator+( const FuzzyNumber &other ) const;
-        FuzzyNumber operator-( const FuzzyNumber &other ) const;
-        FuzzyNumber operator*( const FuzzyNumber &other ) const;
-        FuzzyNumber operator/( const FuzzyNumber &other ) const;
+        // Binary operators are expression templates defined below the class.
+        BasicFuzzyNumber operator-() const;
+
+        // Arithmetic with crisp number, applied in place to bounds of every alpha cut.
+        BasicFuzzyNumber &operator+=( const T &value );
+        BasicFuzzyNumber &operator-=( const T &value );
+        BasicFuzzyNumber &operator*=( const T &value );
+        BasicFuzzyNumber &operator/=( const T &value );
 
-        bool operator==( const FuzzyNumber &other ) const;
+        bool operator==( const BasicFuzzyNumber &other ) const;
 
         // Membership
-        // FuzzyMembership membership( double value ) const;
+        // Highest alpha whose cut contains value, interpolated linearly between stored cuts, found by binary search on
+        // both bounds.
+        FuzzyMembership membership( const T &value ) const;
+
+        // Memberships of values in any order, evaluated in one sweep of both bounds in ascending order of values.
+        std::vector<FuzzyMembership> membership( std::span<const T> values ) const;
+
+      private:
+        // Alpha cuts stored as structure of arrays, sorted by alpha.
+        storage_type m_alphas;
+        storage_type m_lower;
+        storage_type m_upper;
+
+        // Throws std::invalid_argument for invalid alpha cuts, does nothing if built with FUZZYMATH_NO_VALIDATION.
+        void validate() const;
+
+        // Interval at alpha, interpolated between cuts upper - 1 and upper, where upper is the first cut with alpha
+        // level not lower than alpha.
+        BasicInterval<T> interpolate( size_t upper, const T &alpha ) const;
+
+        // Membership of value, where left is the first cut with lower bound above value and right is the first cut
+        // with upper bound below value.
+        T membership_level( size_t left, size_t right, const T &value ) const;
+
+        // Removes interior alpha cuts in place, see simplify().
+        void drop_interpolable_cuts( const T &tolerance );
+
+        // Applies auto_simplify() tolerance to a freshly computed result, if set.
+        void simplify_automatically();
+
+        // Fuzzy number with alpha cuts image( interval ) of alpha cuts of this one, nested from the top.
+        template <typename I>
+        BasicFuzzyNumber enclose_function( I &&image ) const;
+
+        template <typename, typename>
+        friend class FuzzyExpression;
+
+        template <typename, typename>
+        friend class FuzzyTerm;
+
+        template <typename>
+        friend class BasicFuzzyNumberBatch;
+    };
+
+    template <typename T>
+    template <typename F>
+        requires RealFunction<F, T>
+    BasicFuzzyNumber<T> BasicFuzzyNumber<T>::apply_function( F &&func, bool monotone, size_t number_elements ) const
+    {
+        FUZZYMATH_TIME( ApplyFunction );
+
+        storage_type lower( memory_resource() );
+        storage_type upper( memory_resource() );
+        lower.reserve( size() );
+        upper.reserve( size() );
+
+        T width = max() - min();
+
+        for ( size_t i = 0; i < size(); ++i )
+        {
+            BasicInterval<T> interval( m_lower[i], m_upper[i] );
+
+            size_t number_elements_cut = static_cast<size_t>( interval.width() / width * number_elements );
+
+            if ( number_elements_cut < 1 )
+            {
+                number_elements_cut = 1; // Ensure at least one element per cut
+            }
+
+            BasicInterval<T> result = interval.apply_function( func, monotone, number_elements_cut );
+            lower.push_back( result.min() );
+            upper.push_back( result.max() );
+        }
+
+        BasicFuzzyNumber number( storage_type( m_alphas, memory_resource() ), std::move( lower ), std::move( upper ) );
+        number.simplify_automatically();
+        return number;
+    }
+
+    template <typename T>
+    template <typename F, typename E>
+        requires RealFunction<F, T> && IntervalExtension<E, T>
+    BasicFuzzyNumber<T> BasicFuzzyNumber<T>::apply_function_bounded( F &&func, E &&extension, const T &tolerance,
+                                                                     size_t max_iterations ) const
+    {
+        return enclose_function(
+            [&]( const BasicInterval<T> &interval )
+            { return interval.apply_function_bounded( func, extension, tolerance, max_iterations ); } );
+    }
+
+    template <typename T>
+    template <typename F>
+        requires RealFunction<F, T>
+    BasicFuzzyNumber<T> BasicFuzzyNumber<T>::apply_function_lipschitz( F &&func, const T &lipschitz_constant,
+                                                                       const T &tolerance, size_t max_iterations ) const
+    {
+        return enclose_function(
+            [&]( const BasicInterval<T> &interval )
+            { return interval.apply_function_lipschitz( func, lipschitz_constant, tolerance, max_iterations ); } );
+    }
+
+    template <typename T>
+    template <typename I>
+    BasicFuzzyNumber<T> BasicFuzzyNumber<T>::enclose_function( I &&image ) const
+    {
+        FUZZYMATH_TIME( ApplyFunction );
+
+        storage_type lower( size(), memory_resource() );
+        storage_type upper( size(), memory_resource() );
+
+        for ( size_t i = size(); i-- > 0; )
+        {
+            BasicInterval<T> result = image( BasicInterval<T>( m_lower[i], m_upper[i] ) );
+            lower[i] = result.min();
+            upper[i] = result.max();
+
+            // Enclosures are not exact, so a cut may come out narrower than the one above it.
+            if ( i + 1 < size() )
+            {
+                lower[i] = std::min( lower[i], lower[i + 1] );
+                upper[i] = std::max( upper[i], upper[i + 1] );
+            }
+        }
+
+        BasicFuzzyNumber number( already_validated, storage_type( m_alphas, memory_resource() ), std::move( lower ),
+                                 std::move( upper ) );
+        number.simplify_automatically();
+        return number;
+    }
+
+    // Expression templates for fuzzy arithmetic. Operators on fuzzy numbers build a tree of expressions that is
+    // evaluated once per alpha level over the union of alpha levels of all its terms, so only the final fuzzy number is
+    // allocated and validated. Expressions convert implicitly to BasicFuzzyNumber, or explicitly with evaluate().
+    //
+    // Terms reference fuzzy numbers passed as lvalues and own those passed as rvalues, so an expression must not
+    // outlive the named fuzzy numbers it is built from.
+    //
+    // Every expression node provides:
+    //   reset()           - rewind all terms to their first alpha cut,
+    //   next_alpha( p )   - pointer to the lowest alpha level not yet visited by any term, or p if that is lower,
+    //   interval( alpha ) - value of the expression at alpha, alpha must not decrease between calls,
+    //   advance( alpha )  - move terms with alpha cut exactly at alpha to their next cut,
+    //   support()         - value of the expression at alpha 0,
+    //   size_hint()       - upper bound of the number of alpha levels.
+    template <typename Derived, typename T>
+    class FuzzyExpression
+    {
+      public:
+        using value_type = T;
+
+        BasicFuzzyNumber<T> evaluate() const
+        {
+            FUZZYMATH_TIME( Operation );
+
+            const Derived &expression = static_cast<const Derived &>( *this );
+
+            // Columns of the result are built in place, in memory resource of the calling thread.
+            std::pmr::memory_resource *resource = memory_resource();
+            std::pmr::vector<T> alphas( resource );
+            std::pmr::vector<T> lower( resource );
+            std::pmr::vector<T> upper( resource );
+            alphas.reserve( expression.size_hint() );
+            lower.reserve( expression.size_hint() );
+            upper.reserve( expression.size_hint() );
+
+            expression.reset();
+
+            for ( const T *next = expression.next_alpha( nullptr ); next != nullptr;
+                  next = expression.next_alpha( nullptr ) )
+            {
+                T alpha = *next;
+                BasicInterval<T> interval = expression.interval( alpha );
+
+                alphas.push_back( alpha );
+                lower.push_back( interval.min() );
+                upper.push_back( interval.max() );
+
+                expression.advance( alpha );
+            }
+
+            FUZZYMATH_COUNT( AlphaLevels, alphas.size() );
+
+            // Interval arithmetic is inclusion isotone, so alpha cuts of the result are nested.
+            BasicFuzzyNumber<T> number( already_validated, std::move( alphas ), std::move( lower ),
+                                        std::move( upper ) );
+            number.simplify_automatically();
+            return number;
+        }
+
+        operator BasicFuzzyNumber<T>() const { return evaluate(); }
+    };
+
+    // Leaf of expression. Storage is either const reference to fuzzy number or fuzzy number itself.
+    template <typename T, typename Storage>
+    class FuzzyTerm : public FuzzyExpression<FuzzyTerm<T, Storage>, T>
+    {
+      public:
+        explicit FuzzyTerm( Storage number ) : m_number( std::forward<Storage>( number ) ) {}
+
+        void reset() const { m_cursor = 0; }
+
+        const T *next_alpha( const T *lowest ) const
+        {
+            if ( m_cursor < m_number.size() && ( lowest == nullptr || m_number.m_alphas[m_cursor] < *lowest ) )
+                return &m_number.m_alphas[m_cursor];
+            return lowest;
+        }
+
+        BasicInterval<T> interval( const T &alpha ) const { return m_number.interpolate( m_cursor, alpha ); }
+
+        void advance( const T &alpha ) const
+        {
+            if ( m_cursor < m_number.size() && m_number.m_alphas[m_cursor] == alpha )
+                ++m_cursor;
+        }
+
+        BasicInterval<T> support() const { return m_number.support(); }
+
+        size_t size_hint() const { return m_number.size(); }
+
+      private:
+        Storage m_number;
+        mutable size_t m_cursor = 0;
+    };
+
+    template <typename T, typename Op, typename E>
+    class FuzzyUnaryExpression : public FuzzyExpression<FuzzyUnaryExpression<T, Op, E>, T>
+    {
+      public:
+        explicit FuzzyUnaryExpression( E operand ) : m_operand( std::move( operand ) ) {}
+
+        void reset() const { m_operand.reset(); }
+        const T *next_alpha( const T *lowest ) const { return m_operand.next_alpha( lowest ); }
+        BasicInterval<T> interval( const T &alpha ) const { return Op()( m_operand.interval( alpha ) ); }
+        void advance( const T &alpha ) const { m_operand.advance( alpha ); }
+        BasicInterval<T> support() const { return Op()( m_operand.support() ); }
+        size_t size_hint() const { return m_operand.size_hint(); }
 
       private:
-        std::set<AlphaCut> m_alpha_cuts;
+        E m_operand;
+    };
+
+    template <typename T, typename Op, typename L, typename R>
+    class FuzzyBinaryExpression : public FuzzyExpression<FuzzyBinaryExpression<T, Op, L, R>, T>
+    {
+      public:
+        FuzzyBinaryExpression( L lhs, R rhs ) : m_lhs( std::move( lhs ) ), m_rhs( std::move( rhs ) ) {}
+
+        void reset() const
+        {
+            m_lhs.reset();
+            m_rhs.reset();
+        }
+
+        const T *next_alpha( const T *lowest ) const { return m_rhs.next_alpha( m_lhs.next_alpha( lowest ) ); }
+
+        BasicInterval<T> interval( const T &alpha ) const
+        {
+            return Op()( m_lhs.interval( alpha ), m_rhs.interval( alpha ) );
+        }
 
-        std::vector<PreciseFloat> union_of_alpha_cuts( FuzzyNumber &other ) const;
-        FuzzyNumber operation( const FuzzyNumber &other,
-                               const std::function<AlphaCut( const AlphaCut &, const AlphaCut & )> &op ) const;
+        void advance( const T &alpha ) const
+        {
+            m_lhs.advance( alpha );
+            m_rhs.advance( alpha );
+        }
+
+        BasicInterval<T> support() const { return Op()( m_lhs.support(), m_rhs.support() ); }
+
+        size_t size_hint() const { return m_lhs.size_hint() + m_rhs.size_hint(); }
+
+      private:
+        L m_lhs;
+        R m_rhs;
     };
 
+    // Expression with crisp number as the other operand, Op is applied to interval of the operand and the number, so
+    // the crisp number is never turned into a fuzzy number.
+    template <typename T, typename Op, typename E>
+    class FuzzyScalarExpression : public FuzzyExpression<FuzzyScalarExpression<T, Op, E>, T>
+    {
+      public:
+        FuzzyScalarExpression( E operand, T value ) : m_operand( std::move( operand ) ), m_value( std::move( value ) )
+        {
+        }
+
+        void reset() const { m_operand.reset(); }
+        const T *next_alpha( const T *lowest ) const { return m_operand.next_alpha( lowest ); }
+        BasicInterval<T> interval( const T &alpha ) const { return Op()( m_operand.interval( alpha ), m_value ); }
+        void advance( const T &alpha ) const { m_operand.advance( alpha ); }
+        BasicInterval<T> support() const { return Op()( m_operand.support(), m_value ); }
+        size_t size_hint() const { return m_operand.size_hint(); }
+
+      private:
+        E m_operand;
+        T m_value;
+    };
+
+    // Operations of FuzzyScalarExpression with the crisp number on the left side.
+    struct ReverseMinus
+    {
+        template <typename T>
+        BasicInterval<T> operator()( const BasicInterval<T> &interval, const T &value ) const
+        {
+            return -interval + value;
+        }
+    };
+
+    struct ReverseDivides
+    {
+        template <typename T>
+        BasicInterval<T> operator()( const BasicInterval<T> &interval, const T &value ) const
+        {
+            return BasicInterval<T>( value ) / interval;
+        }
+    };
+
+    template <typename E>
+    concept FuzzyExpressionNode = std::derived_from<E, FuzzyExpression<E, typename E::value_type>>;
+
+    // Fuzzy number or expression over fuzzy numbers, in any value category.
+    template <typename E>
+    concept FuzzyOperand =
+        std::same_as<std::remove_cvref_t<E>, BasicFuzzyNumber<typename std::remove_cvref_t<E>::value_type>> ||
+        FuzzyExpressionNode<std::remove_cvref_t<E>>;
+
+    template <typename L, typename R>
+    concept FuzzyOperands = FuzzyOperand<L> && FuzzyOperand<R> &&
+                            std::same_as<typename std::remove_cvref_t<L>::value_type,
+                                         typename std::remove_cvref_t<R>::value_type>;
+
+    // Expression node for operand - fuzzy numbers are wrapped in FuzzyTerm, expressions are copied or moved.
+    template <typename E>
+        requires FuzzyOperand<E>
+    auto fuzzy_operand( E &&operand )
+    {
+        using U = std::remove_cvref_t<E>;
+        using T = typename U::value_type;
+
+        if constexpr ( FuzzyExpressionNode<U> )
+            return U( std::forward<E>( operand ) );
+        else if constexpr ( std::is_lvalue_reference_v<E> )
+            return FuzzyTerm<T, const U &>( operand );
+        else
+            return FuzzyTerm<T, U>( std::move( operand ) );
+    }
+
+    template <typename E>
+    using fuzzy_operand_t = decltype( fuzzy_operand( std::declval<E>() ) );
+
+    template <typename Op, typename L, typename R>
+    auto make_fuzzy_expression( L &&lhs, R &&rhs )
+    {
+        using T = typename std::remove_cvref_t<L>::value_type;
+        return FuzzyBinaryExpression<T, Op, fuzzy_operand_t<L>, fuzzy_operand_t<R>>(
+            fuzzy_operand( std::forward<L>( lhs ) ), fuzzy_operand( std::forward<R>( rhs ) ) );
+    }
+
+    // Expression of operand and crisp number. Division by zero, or of crisp number by operand with support containing
+    // zero, throws std::domain_error.
+    template <typename Op, typename E>
+        requires FuzzyOperand<E>
+    auto make_fuzzy_scalar_expression( E &&operand, typename std::remove_cvref_t<E>::value_type value )
+    {
+        using T = typename std::remove_cvref_t<E>::value_type;
+
+        if constexpr ( std::same_as<Op, std::divides<>> )
+        {
+            if ( value == T( 0 ) )
+            {
+                throw std::domain_error( "Division by zero." );
+            }
+        }
+        else if constexpr ( std::same_as<Op, ReverseDivides> )
+        {
+            if ( operand.support().contains( T( 0 ) ) )
+            {
+                throw std::domain_error( "Division by FuzzyNumber containing zero." );
+            }
+        }
+
+        return FuzzyScalarExpression<T, Op, fuzzy_operand_t<E>>( fuzzy_operand( std::forward<E>( operand ) ),
+                                                                std::move( value ) );
+    }
+
+    template <typename L, typename R>
+        requires FuzzyOperands<L, R>
+    auto operator+( L &&lhs, R &&rhs )
+    {
+        return make_fuzzy_expression<std::plus<>>( std::forward<L>( lhs ), std::forward<R>( rhs ) );
+    }
+
+    template <typename L, typename R>
+        requires FuzzyOperands<L, R>
+    auto operator-( L &&lhs, R &&rhs )
+    {
+        return make_fuzzy_expression<std::minus<>>( std::forward<L>( lhs ), std::forward<R>( rhs ) );
+    }
+
+    template <typename L, typename R>
+        requires FuzzyOperands<L, R>
+    auto operator*( L &&lhs, R &&rhs )
+    {
+        return make_fuzzy_expression<std::multiplies<>>( std::forward<L>( lhs ), std::forward<R>( rhs ) );
+    }
+
+    template <typename L, typename R>
+        requires FuzzyOperands<L, R>
+    auto operator/( L &&lhs, R &&rhs )
+    {
+        using T = typename std::remove_cvref_t<L>::value_type;
+
+        // Checked while building the expression, so the error is raised where the division is written.
+        if ( rhs.support().contains( T( 0 ) ) )
+        {
+            throw std::domain_error( "Division by FuzzyNumber containing zero." );
+        }
+
+        return make_fuzzy_expression<std::divides<>>( std::forward<L>( lhs ), std::forward<R>( rhs ) );
+    }
+
+    template <typename E>
+        requires FuzzyExpressionNode<std::remove_cvref_t<E>>
+    auto operator-( E &&operand )
+    {
+        using U = std::remove_cvref_t<E>;
+        return FuzzyUnaryExpression<typename U::value_type, std::negate<>, U>( std::forward<E>( operand ) );
+    }
+
+    using FuzzyNumber = BasicFuzzyNumber<PreciseFloat>;
+
+    extern template class DLL_API BasicFuzzyNumber<PreciseFloat>;
+    extern template class DLL_API BasicFuzzyNumber<double>;
+    extern template class DLL_API BasicFuzzyNumber<long double>;
+#ifdef FUZZYMATH_HAS_FLOAT128
+    extern template class DLL_API BasicFuzzyNumber<QuadFloat>;
+#endif
+
 } // namespace FuzzyMath
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "FuzzyMath.h"
+#include "FuzzyNumber.h"
+#include "Interval.h"
+#include "Types.h"
+
+namespace FuzzyMath
+{
+    // Collection of fuzzy numbers sharing one set of alpha levels. Lower and upper bounds are stored as two dense
+    // row-major matrices with one row per fuzzy number and one column per alpha level, so element-wise operations are
+    // plain loops over contiguous memory.
+    template <typename T>
+    class BasicFuzzyNumberBatch
+    {
+      public:
+        using value_type = T;
+        using fuzzy_number_type = BasicFuzzyNumber<T>;
+
+        // Bounds are row-major matrices of size number of fuzzy numbers x number of alpha levels.
+        BasicFuzzyNumberBatch( std::vector<T> alphas, std::vector<T> lower, std::vector<T> upper );
+        BasicFuzzyNumberBatch( AlreadyValidated, std::vector<T> alphas, std::vector<T> lower, std::vector<T> upper );
+
+        // Fuzzy numbers are sampled at given alpha levels, alpha cuts between their own levels are interpolated.
+        BasicFuzzyNumberBatch( const std::vector<BasicFuzzyNumber<T>> &numbers, std::vector<T> alphas );
+        BasicFuzzyNumberBatch( const std::vector<BasicFuzzyNumber<T>> &numbers, size_t number_of_cuts = 2 );
+
+        size_t size() const;
+        size_t number_of_cuts() const;
+
+        std::span<const T> alpha_levels() const;
+        std::span<const T> lower_bounds( size_t index ) const;
+        std::span<const T> upper_bounds( size_t index ) const;
+
+        BasicFuzzyNumber<T> fuzzy_number( size_t index ) const;
+        BasicFuzzyNumber<T> operator[]( size_t index ) const;
+        std::vector<BasicFuzzyNumber<T>> fuzzy_numbers() const;
+
+        BasicFuzzyNumberBatch apply_function( const std::function<T( const T & )> &func, bool monotone = false,
+                                              size_t number_elements = 1000 ) const;
+
+        template <typename F>
+            requires RealFunction<F, T>
+        BasicFuzzyNumberBatch apply_function( F &&func, bool monotone = false, size_t number_elements = 1000 ) const;
+
+        // Element-wise arithmetic, both batches must have the same size and alpha levels.
+        BasicFuzzyNumberBatch operator-() const;
+        BasicFuzzyNumberBatch operator+( const BasicFuzzyNumberBatch &other ) const;
+        BasicFuzzyNumberBatch operator-( const BasicFuzzyNumberBatch &other ) const;
+        BasicFuzzyNumberBatch operator*( const BasicFuzzyNumberBatch &other ) const;
+        BasicFuzzyNumberBatch operator/( const BasicFuzzyNumberBatch &other ) const;
+
+        bool operator==( const BasicFuzzyNumberBatch &other ) const;
+
+      private:
+        std::vector<T> m_alphas;
+        std::vector<T> m_lower;
+        std::vector<T> m_upper;
+
+        // Throws std::invalid_argument for invalid bounds, does nothing if built with FUZZYMATH_NO_VALIDATION.
+        void validate() const;
+        void check_compatible( const BasicFuzzyNumberBatch &other ) const;
+    };
+
+    template <typename T>
+    template <typename F>
+        requires RealFunction<F, T>
+    BasicFuzzyNumberBatch<T> BasicFuzzyNumberBatch<T>::apply_function( F &&func, bool monotone,
+                                                                       size_t number_elements ) const
+    {
+        size_t cuts = number_of_cuts();
+
+        std::vector<T> lower( m_lower.size() );
+        std::vector<T> upper( m_upper.size() );
+
+        for ( size_t row = 0; row < size(); ++row )
+        {
+            size_t offset = row * cuts;
+            T width = m_upper[offset] - m_lower[offset];
+
+            for ( size_t i = offset; i < offset + cuts; ++i )
+            {
+                BasicInterval<T> interval( m_lower[i], m_upper[i] );
+
+                size_t number_elements_cut = number_elements;
+
+                if ( width > T( 0 ) )
+                {
+                    number_elements_cut = static_cast<size_t>( interval.width() / width * number_elements );
+                }
+
+                if ( number_elements_cut < 1 )
+                {
+                    number_elements_cut = 1; // Ensure at least one element per cut
+                }
+
+                BasicInterval<T> result = interval.apply_function( func, monotone, number_elements_cut );
+                lower[i] = result.min();
+                upper[i] = result.max();
+            }
+        }
+
+        return BasicFuzzyNumberBatch( m_alphas, std::move( lower ), std::move( upper ) );
+    }
+
+    using FuzzyNumberBatch = BasicFuzzyNumberBatch<PreciseFloat>;
+
+    extern template class DLL_API BasicFuzzyNumberBatch<PreciseFloat>;
+    extern template class DLL_API BasicFuzzyNumberBatch<double>;
+    extern template class DLL_API BasicFuzzyNumberBatch<long double>;
+#ifdef FUZZYMATH_HAS_FLOAT128
+    extern template class DLL_API BasicFuzzyNumberBatch<QuadFloat>;
+#endif
+
+} // namespace FuzzyMath
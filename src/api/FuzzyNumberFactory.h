@@ -1,25 +1,55 @@
 #pragma once
 
+#include <span>
+#include <vector>
+
 #include "FuzzyMath.h"
 #include "FuzzyNumber.h"
+#include "FuzzyNumberBatch.h"
 #include "Interval.h"
 
 namespace FuzzyMath
 {
-    class DLL_API FuzzyNumberFactory
+    template <typename T>
+    class BasicFuzzyNumberFactory
     {
       public:
-        static FuzzyNumber triangular( PreciseFloat minimum, PreciseFloat kernel, PreciseFloat maximum,
-                                       int number_of_cuts = 2 );
-        static FuzzyNumber triangular( std::string minimum, std::string kernel, std::string maximum,
-                                       int number_of_cuts = 2 );
-
-        static FuzzyNumber trapezoidal( PreciseFloat minimum, PreciseFloat kernel_minimum, PreciseFloat kernel_maximum,
-                                        PreciseFloat maximum, int number_of_cuts = 2 );
-        static FuzzyNumber trapezoidal( std::string minimum, std::string kernel_minimum, std::string kernel_maximum,
-                                        std::string maximum, int number_of_cuts = 2 );
-
-        static FuzzyNumber crisp_number( PreciseFloat value );
-        static FuzzyNumber crisp_number( std::string value );
+        static BasicFuzzyNumber<T> triangular( T minimum, T kernel, T maximum, int number_of_cuts = 2 );
+        static BasicFuzzyNumber<T> triangular( std::string minimum, std::string kernel, std::string maximum,
+                                               int number_of_cuts = 2 );
+
+        static BasicFuzzyNumber<T> trapezoidal( T minimum, T kernel_minimum, T kernel_maximum, T maximum,
+                                                int number_of_cuts = 2 );
+        static BasicFuzzyNumber<T> trapezoidal( std::string minimum, std::string kernel_minimum,
+                                                std::string kernel_maximum, std::string maximum,
+                                                int number_of_cuts = 2 );
+
+        static BasicFuzzyNumber<T> crisp_number( T value );
+        static BasicFuzzyNumber<T> crisp_number( std::string value );
+
+        // Many fuzzy numbers from columns of parameters, one row per fuzzy number. The alpha levels are computed once
+        // and shared by all numbers.
+        static BasicFuzzyNumberBatch<T> triangular_batch( std::span<const T> minimum, std::span<const T> kernel,
+                                                          std::span<const T> maximum, int number_of_cuts = 2 );
+        static BasicFuzzyNumberBatch<T> trapezoidal_batch( std::span<const T> minimum,
+                                                           std::span<const T> kernel_minimum,
+                                                           std::span<const T> kernel_maximum,
+                                                           std::span<const T> maximum, int number_of_cuts = 2 );
+
+        static std::vector<BasicFuzzyNumber<T>> triangular( std::span<const T> minimum, std::span<const T> kernel,
+                                                            std::span<const T> maximum, int number_of_cuts = 2 );
+        static std::vector<BasicFuzzyNumber<T>> trapezoidal( std::span<const T> minimum,
+                                                             std::span<const T> kernel_minimum,
+                                                             std::span<const T> kernel_maximum,
+                                                             std::span<const T> maximum, int number_of_cuts = 2 );
     };
-} // namespace FuzzyMath
\ No newline at end of file
+
+    using FuzzyNumberFactory = BasicFuzzyNumberFactory<PreciseFloat>;
+
+    extern template class DLL_API BasicFuzzyNumberFactory<PreciseFloat>;
+    extern template class DLL_API BasicFuzzyNumberFactory<double>;
+    extern template class DLL_API BasicFuzzyNumberFactory<long double>;
+#ifdef FUZZYMATH_HAS_FLOAT128
+    extern template class DLL_API BasicFuzzyNumberFactory<QuadFloat>;
+#endif
+} // namespace FuzzyMath
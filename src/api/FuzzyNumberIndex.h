@@ -0,0 +1,79 @@
+#pragma once
+
+#include <limits>
+#include <vector>
+
+#include "FuzzyDistance.h"
+#include "FuzzyMath.h"
+#include "FuzzyNumber.h"
+#include "Types.h"
+
+namespace FuzzyMath
+{
+    // Vantage point tree over a library of fuzzy numbers for nearest neighbour and radius queries. Every node splits
+    // the numbers below it by the median distance to its vantage point, and the triangle inequality of the metric
+    // prunes subtrees that cannot contain a match, so queries evaluate only a fraction of distances. Building the
+    // index takes O(n log n) distances.
+    template <typename T>
+    class BasicFuzzyNumberIndex
+    {
+      public:
+        struct Neighbour
+        {
+            // Position of the fuzzy number in the library.
+            size_t index;
+            T distance;
+
+            bool operator==( const Neighbour &other ) const = default;
+        };
+
+        explicit BasicFuzzyNumberIndex( std::vector<BasicFuzzyNumber<T>> numbers,
+                                        DistanceMetric metric = DistanceMetric::L2 );
+
+        size_t size() const;
+        DistanceMetric metric() const;
+        const BasicFuzzyNumber<T> &operator[]( size_t index ) const;
+
+        // At most k numbers closest to query, and all numbers within radius of it (inclusive), both ordered by
+        // distance and then by index.
+        std::vector<Neighbour> nearest( const BasicFuzzyNumber<T> &query, size_t k ) const;
+        std::vector<Neighbour> within( const BasicFuzzyNumber<T> &query, const T &radius ) const;
+
+      private:
+        static constexpr size_t no_node = std::numeric_limits<size_t>::max();
+
+        // Numbers at distance up to threshold from the vantage point are in the inside subtree, numbers at distance
+        // from threshold on in the outside one.
+        struct Node
+        {
+            size_t vantage_point;
+            T threshold;
+            size_t inside = no_node;
+            size_t outside = no_node;
+        };
+
+        std::vector<BasicFuzzyNumber<T>> m_numbers;
+        DistanceMetric m_metric;
+        std::vector<Node> m_nodes;
+        size_t m_root = no_node;
+
+        T distance( const BasicFuzzyNumber<T> &a, const BasicFuzzyNumber<T> &b ) const;
+
+        // Builds subtree of numbers indices[first, last) and returns its node.
+        size_t build( std::vector<size_t> &indices, std::vector<T> &distances, size_t first, size_t last );
+
+        // Visits nodes whose subtree may contain numbers within radius(), which may shrink during the search, and
+        // passes each evaluated number to accept( index, distance ).
+        template <typename R, typename A>
+        void search( size_t node, const BasicFuzzyNumber<T> &query, R &&radius, A &&accept ) const;
+    };
+
+    using FuzzyNumberIndex = BasicFuzzyNumberIndex<PreciseFloat>;
+
+    extern template class DLL_API BasicFuzzyNumberIndex<PreciseFloat>;
+    extern template class DLL_API BasicFuzzyNumberIndex<double>;
+    extern template class DLL_API BasicFuzzyNumberIndex<long double>;
+#ifdef FUZZYMATH_HAS_FLOAT128
+    extern template class DLL_API BasicFuzzyNumberIndex<QuadFloat>;
+#endif
+} // namespace FuzzyMath
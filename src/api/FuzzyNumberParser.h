@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "FuzzyMath.h"
+#include "FuzzyNumber.h"
+#include "Interval.h"
+#include "Types.h"
+
+namespace FuzzyMath
+{
+    // Layout of one line of text.
+    enum class RecordFormat : std::uint8_t
+    {
+        // minimum, kernel, maximum
+        Triangular,
+        // minimum, kernel minimum, kernel maximum, maximum
+        Trapezoidal,
+        // alpha, lower, upper repeated for every alpha cut, alphas increasing from 0 to 1
+        AlphaCuts
+    };
+
+    // Position of invalid record in parsed text. Row and column are counted from 1, column points to the field that
+    // caused the error. Message is a string literal.
+    struct ParseError
+    {
+        size_t row;
+        size_t column;
+        const char *message;
+    };
+
+    // Parser of delimited text with one record per line, such as "1.5;2.0;3.5". Hardware floating point types are
+    // parsed with std::from_chars, other types read up to 19 significant decimal digits into an integer and scale it
+    // by a power of ten, longer numbers fall back to the string constructor of T. Fields are parsed in place, so no
+    // memory is allocated per field.
+    //
+    // Invalid records are skipped and reported as ParseError, the parser does not throw on malformed input. Empty lines
+    // are ignored, fields may be surrounded by spaces or tabs and lines may end with "\r\n".
+    template <typename T>
+    class BasicFuzzyNumberParser
+    {
+      public:
+        // Number of cuts is used for triangular and trapezoidal records.
+        explicit BasicFuzzyNumberParser( RecordFormat format, char delimiter = ';', int number_of_cuts = 2 );
+
+        // Parses complete lines of buffer, appends records to output and errors to errors. Returns number of consumed
+        // bytes. Unless last is true, incomplete line at the end of buffer is not consumed and should be passed again
+        // at the start of the next buffer. Rows are counted across calls, so a large input can be parsed in chunks.
+        size_t parse( std::string_view buffer, std::vector<BasicFuzzyNumber<T>> &output,
+                      std::vector<ParseError> &errors, bool last = true );
+
+        // Records of two fields, the endpoints of interval. Record format is ignored.
+        size_t parse_intervals( std::string_view buffer, std::vector<BasicInterval<T>> &output,
+                                std::vector<ParseError> &errors, bool last = true );
+
+        // Parses whole text, rows are counted from its first line.
+        std::vector<BasicFuzzyNumber<T>> parse( std::string_view text, std::vector<ParseError> &errors );
+        std::vector<BasicInterval<T>> parse_intervals( std::string_view text, std::vector<ParseError> &errors );
+
+        // Number of rows consumed so far.
+        size_t row() const;
+        void reset();
+
+      private:
+        RecordFormat m_format;
+        char m_delimiter;
+        int m_number_of_cuts;
+        size_t m_row = 0;
+
+        // Values and starting columns of fields of the current record, reused between records.
+        std::vector<T> m_values;
+        std::vector<size_t> m_columns;
+
+        // Calls record( line ) for every non-empty line whose fields are all numbers, the values are in m_values.
+        template <typename R>
+        size_t parse_lines( std::string_view buffer, bool last, std::vector<ParseError> &errors, R &&record );
+
+        bool read_fields( std::string_view line, std::vector<ParseError> &errors );
+        bool check_field_count( size_t expected, bool multiple, size_t line_length, std::vector<ParseError> &errors );
+    };
+
+    using FuzzyNumberParser = BasicFuzzyNumberParser<PreciseFloat>;
+
+    extern template class DLL_API BasicFuzzyNumberParser<PreciseFloat>;
+    extern template class DLL_API BasicFuzzyNumberParser<double>;
+    extern template class DLL_API BasicFuzzyNumberParser<long double>;
+#ifdef FUZZYMATH_HAS_FLOAT128
+    extern template class DLL_API BasicFuzzyNumberParser<QuadFloat>;
+#endif
+} // namespace FuzzyMath
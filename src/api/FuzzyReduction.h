@@ -0,0 +1,41 @@
+#pragma once
+
+#include <span>
+
+#include "FuzzyMath.h"
+#include "FuzzyNumber.h"
+#include "Types.h"
+
+namespace FuzzyMath
+{
+    // Reductions of many fuzzy numbers, evaluated over the union of their alpha levels, which is merged once. Numbers
+    // are split into blocks of fixed size, accumulated per alpha level on number_of_threads threads (zero uses
+    // std::thread::hardware_concurrency()), and partial results of blocks are combined by a pairwise tree. The shape of
+    // the tree depends only on the number of blocks, so results are identical for any number of threads.
+    //
+    // Throws std::invalid_argument for an empty range.
+    template <typename T>
+    class BasicFuzzyReduction
+    {
+      public:
+        static BasicFuzzyNumber<T> sum( std::span<const BasicFuzzyNumber<T>> numbers, size_t number_of_threads = 0 );
+        static BasicFuzzyNumber<T> product( std::span<const BasicFuzzyNumber<T>> numbers,
+                                            size_t number_of_threads = 0 );
+
+        // Sum of numbers[i] * weights[i], weights must have the same size as numbers.
+        static BasicFuzzyNumber<T> weighted_sum( std::span<const BasicFuzzyNumber<T>> numbers,
+                                                 std::span<const T> weights, size_t number_of_threads = 0 );
+
+        // Numbers accumulated sequentially before partial results enter the tree.
+        static constexpr size_t block_size = 256;
+    };
+
+    using FuzzyReduction = BasicFuzzyReduction<PreciseFloat>;
+
+    extern template class DLL_API BasicFuzzyReduction<PreciseFloat>;
+    extern template class DLL_API BasicFuzzyReduction<double>;
+    extern template class DLL_API BasicFuzzyReduction<long double>;
+#ifdef FUZZYMATH_HAS_FLOAT128
+    extern template class DLL_API BasicFuzzyReduction<QuadFloat>;
+#endif
+} // namespace FuzzyMath
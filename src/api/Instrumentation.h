@@ -0,0 +1,119 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include "FuzzyMath.h"
+
+namespace FuzzyMath
+{
+    // Counters of work done on hot paths of the library, collected only when built with FUZZYMATH_INSTRUMENTATION
+    // (CMake option WITH_INSTRUMENTATION). Otherwise FUZZYMATH_COUNT and FUZZYMATH_TIME expand to nothing and
+    // snapshot() returns zeros.
+    //
+    // Counters are kept per thread, without synchronization. Work of helper threads started by parallel functions is
+    // counted on the calling thread. Timers measure inclusive wall time of their scope, so nested timers (operation
+    // constructing a fuzzy number) overlap. Timers read a clock twice per scope and must be switched on with
+    // enable_timers().
+    namespace Instrumentation
+    {
+        enum class Counter : std::uint8_t
+        {
+            // Alpha levels of results of fuzzy arithmetic, the union of alpha levels of operands.
+            AlphaLevels,
+            // Alpha cuts interpolated between two stored alpha levels.
+            Interpolations,
+            // Evaluations of functions passed to apply_function and its variants.
+            FunctionSamples,
+            // Fuzzy numbers constructed, including trusted construction.
+            FuzzyNumbers,
+            // Fuzzy numbers validated.
+            Validations
+        };
+
+        inline constexpr size_t number_of_counters = 5;
+
+        enum class Timer : std::uint8_t
+        {
+            // Evaluation of arithmetic expression of fuzzy numbers.
+            Operation,
+            // BasicFuzzyNumber::alpha_cut.
+            AlphaCut,
+            // BasicFuzzyNumber::apply_function and its variants.
+            ApplyFunction,
+            // Validating constructors of BasicFuzzyNumber.
+            Construction
+        };
+
+        inline constexpr size_t number_of_timers = 4;
+
+        struct TimerStatistics
+        {
+            std::uint64_t calls = 0;
+            std::chrono::nanoseconds elapsed{ 0 };
+        };
+
+        struct Snapshot
+        {
+            std::array<std::uint64_t, number_of_counters> counters{};
+            std::array<TimerStatistics, number_of_timers> timers{};
+
+            std::uint64_t operator[]( Counter counter ) const { return counters[static_cast<size_t>( counter )]; }
+            const TimerStatistics &operator[]( Timer timer ) const { return timers[static_cast<size_t>( timer )]; }
+        };
+
+#ifdef FUZZYMATH_INSTRUMENTATION
+        inline constexpr bool enabled = true;
+#else
+        inline constexpr bool enabled = false;
+#endif
+
+        // Counters and timers of the calling thread.
+        DLL_API Snapshot snapshot();
+        DLL_API void reset();
+
+        // Timers are off by default, the switch is shared by all threads.
+        DLL_API void enable_timers( bool enable );
+        DLL_API bool timers_enabled();
+
+        DLL_API void add( Counter counter, std::uint64_t value );
+        DLL_API void add_time( Timer timer, std::chrono::nanoseconds elapsed );
+
+        class ScopedTimer
+        {
+          public:
+            explicit ScopedTimer( Timer timer ) : m_timer( timer ), m_active( timers_enabled() )
+            {
+                if ( m_active )
+                    m_start = std::chrono::steady_clock::now();
+            }
+
+            ~ScopedTimer()
+            {
+                if ( m_active )
+                    add_time( m_timer, std::chrono::steady_clock::now() - m_start );
+            }
+
+            ScopedTimer( const ScopedTimer & ) = delete;
+            ScopedTimer &operator=( const ScopedTimer & ) = delete;
+
+          private:
+            Timer m_timer;
+            bool m_active;
+            std::chrono::steady_clock::time_point m_start;
+        };
+    } // namespace Instrumentation
+} // namespace FuzzyMath
+
+#ifdef FUZZYMATH_INSTRUMENTATION
+#define FUZZYMATH_COUNT( counter, value )                                                                              \
+    ::FuzzyMath::Instrumentation::add( ::FuzzyMath::Instrumentation::Counter::counter,                                 \
+                                       static_cast<std::uint64_t>( value ) )
+#define FUZZYMATH_TIME( timer )                                                                                        \
+    ::FuzzyMath::Instrumentation::ScopedTimer fuzzymath_scoped_timer( ::FuzzyMath::Instrumentation::Timer::timer )
+#else
+#define FUZZYMATH_COUNT( counter, value ) static_cast<void>( 0 )
+#define FUZZYMATH_TIME( timer ) static_cast<void>( 0 )
+#endif
@@ -1,69 +1,346 @@
 #pragma once
 
+#include <algorithm>
 #include <functional>
+#include <future>
+#include <memory_resource>
 #include <ostream>
 #include <stdexcept>
+#include <thread>
+#include <vector>
 
 #include <boost/numeric/interval.hpp>
 
 #include "FuzzyMath.h"
+#include "Instrumentation.h"
+#include "MemoryResource.h"
 #include "Types.h"
 
 namespace FuzzyMath
 {
-    class DLL_API Interval
+    template <typename T>
+    class BasicInterval;
+
+    // Interval extension of a real function, for a box returns an interval containing all values of the function on it.
+    template <typename E, typename T>
+    concept IntervalExtension =
+        std::invocable<E, const BasicInterval<T> &> &&
+        std::convertible_to<std::invoke_result_t<E, const BasicInterval<T> &>, BasicInterval<T>>;
+
+    template <typename T>
+    class BasicInterval
     {
       public:
-        Interval();
-        Interval( const PreciseFloat &a, const PreciseFloat &b );
-        Interval( const PreciseFloat &a );
-        Interval( const std::string &a, const std::string &b );
-        Interval( const std::string &a );
-        Interval( const Interval &other );
-
-        PreciseFloat min() const;
-        PreciseFloat max() const;
+        using value_type = T;
+
+        BasicInterval();
+        BasicInterval( const T &a, const T &b );
+        BasicInterval( const T &a );
+        BasicInterval( const std::string &a, const std::string &b );
+        BasicInterval( const std::string &a );
+        BasicInterval( const BasicInterval &other );
+
+        T min() const;
+        T max() const;
         long double min_as_double() const;
         long double max_as_double() const;
         bool is_degenerate() const;
         bool is_empty() const;
-        PreciseFloat width() const;
-        PreciseFloat mid_point() const;
+        T width() const;
+        T mid_point() const;
 
         std::string to_string() const;
 
-        bool contains( const PreciseFloat &x ) const;
-        bool contains( const Interval &other ) const;
+        bool contains( const T &x ) const;
+        bool contains( const BasicInterval &other ) const;
+
+        bool intersects( const BasicInterval &other ) const;
+        BasicInterval intersection( const BasicInterval &other ) const;
+        BasicInterval unite( const BasicInterval &other ) const;
+        BasicInterval union_hull( const BasicInterval &other ) const;
+
+        BasicInterval apply_function( const std::function<T( const T & )> &func, bool monotone = false,
+                                      size_t number_elements = 1000 ) const;
+
+        // Overload for any callable, which lets the compiler inline the function into the sampling loop.
+        template <typename F>
+            requires RealFunction<F, T>
+        BasicInterval apply_function( F &&func, bool monotone = false, size_t number_elements = 1000 ) const;
+
+        // Non-monotone apply_function with samples split into chunks evaluated on separate threads. The result is the
+        // same as from apply_function, func must be safe to call concurrently. Zero number_of_threads uses
+        // std::thread::hardware_concurrency().
+        template <typename F>
+            requires RealFunction<F, T>
+        BasicInterval apply_function_parallel( F &&func, size_t number_elements = 1000,
+                                               size_t number_of_threads = 0 ) const;
 
-        bool intersects( const Interval &other ) const;
-        Interval intersection( const Interval &other ) const;
-        Interval unite( const Interval &other ) const;
-        Interval union_hull( const Interval &other ) const;
+        // Enclosure of the image of func found by branch and bound. The interval is bisected adaptively, sub-boxes
+        // whose bound cannot improve the current minimum or maximum are pruned, and each bound of the result is within
+        // tolerance of the exact extremum unless max_iterations bisections per bound are used up. The result is a
+        // guaranteed enclosure as long as extension is an interval extension of func.
+        template <typename F, typename E>
+            requires RealFunction<F, T> && IntervalExtension<E, T>
+        BasicInterval apply_function_bounded( F &&func, E &&extension, const T &tolerance,
+                                              size_t max_iterations = 1000 ) const;
 
-        Interval apply_function( const std::function<PreciseFloat( const PreciseFloat & )> &func, bool monotone = false,
-                                 size_t number_elements = 1000 ) const;
+        // Same as apply_function_bounded, with bounds on sub-boxes derived from Lipschitz constant of func.
+        template <typename F>
+            requires RealFunction<F, T>
+        BasicInterval apply_function_lipschitz( F &&func, const T &lipschitz_constant, const T &tolerance,
+                                                size_t max_iterations = 1000 ) const;
 
-        Interval power( int exponent ) const;
+        BasicInterval power( int exponent ) const;
 
-        Interval operator+( const Interval &other ) const;
-        Interval operator-( const Interval &other ) const;
-        Interval operator*( const Interval &other ) const;
-        Interval operator/( const Interval &other ) const;
+        BasicInterval operator+( const BasicInterval &other ) const;
+        BasicInterval operator-( const BasicInterval &other ) const;
+        BasicInterval operator*( const BasicInterval &other ) const;
+        BasicInterval operator/( const BasicInterval &other ) const;
 
-        Interval operator-() const;
-        bool operator==( const Interval &other ) const;
-        bool operator<( const Interval &other ) const;
-        bool operator>( const Interval &other ) const;
+        // Arithmetic with crisp number, shifts or scales the bounds directly.
+        BasicInterval operator+( const T &value ) const;
+        BasicInterval operator-( const T &value ) const;
+        BasicInterval operator*( const T &value ) const;
+        BasicInterval operator/( const T &value ) const;
 
-        bool operator<( const PreciseFloat &other ) const;
-        bool operator>( const PreciseFloat &other ) const;
+        BasicInterval operator-() const;
+        bool operator==( const BasicInterval &other ) const;
+        bool operator<( const BasicInterval &other ) const;
+        bool operator>( const BasicInterval &other ) const;
+
+        bool operator<( const T &other ) const;
+        bool operator>( const T &other ) const;
 
         bool operator<( const std::string &other ) const;
         bool operator>( const std::string &other ) const;
 
       private:
-        boost::numeric::interval<PreciseFloat>
-            m_interval_value; // Internal representation using Boost's interval library
+        boost::numeric::interval<T> m_interval_value; // Internal representation using Boost's interval library
+
+        // Range of values of func at samples first to last (inclusive) out of number_elements + 1 equidistant samples.
+        template <typename F>
+        BasicInterval sample_function( F &func, size_t first, size_t last, size_t number_elements ) const;
+
+        // Lower bound on the minimum of func, bound( box, value ) returns lower bound of func on box given the value of
+        // func in the middle of box.
+        template <typename F, typename B>
+        T minimum_bound( F &func, B &bound, const T &tolerance, size_t max_iterations ) const;
     };
 
+    template <typename T>
+    template <typename F>
+        requires RealFunction<F, T>
+    BasicInterval<T> BasicInterval<T>::apply_function( F &&func, bool monotone, size_t number_elements ) const
+    {
+        if ( is_empty() )
+            return BasicInterval();
+
+        if ( monotone )
+        {
+            FUZZYMATH_COUNT( FunctionSamples, 2 );
+            T val1 = func( min() );
+            T val2 = func( max() );
+            return BasicInterval( std::min( val1, val2 ), std::max( val1, val2 ) );
+        }
+
+        if ( number_elements < 2 )
+        {
+            number_elements = 2; // Ensure at least two points for a valid interval
+        }
+
+        FUZZYMATH_COUNT( FunctionSamples, number_elements + 1 );
+
+        return sample_function( func, 0, number_elements, number_elements );
+    }
+
+    template <typename T>
+    template <typename F>
+        requires RealFunction<F, T>
+    BasicInterval<T> BasicInterval<T>::apply_function_parallel( F &&func, size_t number_elements,
+                                                                size_t number_of_threads ) const
+    {
+        if ( is_empty() )
+            return BasicInterval();
+
+        if ( number_elements < 2 )
+        {
+            number_elements = 2; // Ensure at least two points for a valid interval
+        }
+
+        if ( number_of_threads == 0 )
+        {
+            number_of_threads = std::max( std::thread::hardware_concurrency(), 1u );
+        }
+
+        size_t number_samples = number_elements + 1;
+        FUZZYMATH_COUNT( FunctionSamples, number_samples );
+        size_t number_chunks = std::min( number_of_threads, number_samples );
+        size_t chunk_size = number_samples / number_chunks;
+        size_t remainder = number_samples % number_chunks;
+
+        // Index of the first sample of chunk, the first remainder chunks take one extra sample.
+        auto chunk_start = [chunk_size, remainder]( size_t chunk )
+        { return chunk * chunk_size + std::min( chunk, remainder ); };
+
+        // First chunk is evaluated on the calling thread, others asynchronously.
+        std::pmr::vector<std::future<BasicInterval>> chunks( memory_resource() );
+        chunks.reserve( number_chunks - 1 );
+
+        for ( size_t chunk = 1; chunk < number_chunks; ++chunk )
+        {
+            size_t first = chunk_start( chunk );
+            size_t last = chunk_start( chunk + 1 ) - 1;
+            chunks.push_back( std::async( std::launch::async, [this, &func, first, last, number_elements]()
+                                          { return sample_function( func, first, last, number_elements ); } ) );
+        }
+
+        BasicInterval result = sample_function( func, 0, chunk_start( 1 ) - 1, number_elements );
+
+        // Chunks are reduced in order, so the first exception by sample order is the one rethrown.
+        for ( std::future<BasicInterval> &chunk : chunks )
+        {
+            BasicInterval chunk_result = chunk.get();
+            result = BasicInterval( std::min( result.min(), chunk_result.min() ),
+                                    std::max( result.max(), chunk_result.max() ) );
+        }
+
+        return result;
+    }
+
+    template <typename T>
+    template <typename F, typename E>
+        requires RealFunction<F, T> && IntervalExtension<E, T>
+    BasicInterval<T> BasicInterval<T>::apply_function_bounded( F &&func, E &&extension, const T &tolerance,
+                                                               size_t max_iterations ) const
+    {
+        if ( is_empty() )
+            return BasicInterval();
+
+        auto negative_func = [&func]( const T &x ) -> T { return -func( x ); };
+
+        auto lower_bound = [&extension]( const BasicInterval &box, const T & ) -> T
+        { return BasicInterval( extension( box ) ).min(); };
+        auto upper_bound = [&extension]( const BasicInterval &box, const T & ) -> T
+        { return -BasicInterval( extension( box ) ).max(); };
+
+        return BasicInterval( minimum_bound( func, lower_bound, tolerance, max_iterations ),
+                              -minimum_bound( negative_func, upper_bound, tolerance, max_iterations ) );
+    }
+
+    template <typename T>
+    template <typename F>
+        requires RealFunction<F, T>
+    BasicInterval<T> BasicInterval<T>::apply_function_lipschitz( F &&func, const T &lipschitz_constant,
+                                                                 const T &tolerance, size_t max_iterations ) const
+    {
+        if ( lipschitz_constant < T( 0 ) )
+        {
+            throw std::invalid_argument( "Lipschitz constant must be non-negative." );
+        }
+
+        if ( is_empty() )
+            return BasicInterval();
+
+        auto negative_func = [&func]( const T &x ) -> T { return -func( x ); };
+
+        // |f(x) - f(mid)| <= L * width / 2 on the whole box, for f and -f alike.
+        auto bound = [&lipschitz_constant]( const BasicInterval &box, const T &value ) -> T
+        { return value - lipschitz_constant * box.width() / T( 2 ); };
+
+        return BasicInterval( minimum_bound( func, bound, tolerance, max_iterations ),
+                              -minimum_bound( negative_func, bound, tolerance, max_iterations ) );
+    }
+
+    template <typename T>
+    template <typename F, typename B>
+    T BasicInterval<T>::minimum_bound( F &func, B &bound, const T &tolerance, size_t max_iterations ) const
+    {
+        struct Box
+        {
+            T bound;
+            T min;
+            T max;
+        };
+
+        // Best value of func found so far, the exact minimum is not above it.
+        T best = std::min<T>( func( min() ), func( max() ) );
+        FUZZYMATH_COUNT( FunctionSamples, 2 );
+
+        if ( is_degenerate() )
+            return best;
+
+        auto make_box = [&func, &bound, &best]( const T &a, const T &b ) -> Box
+        {
+            T value = func( a + ( b - a ) / T( 2 ) );
+            FUZZYMATH_COUNT( FunctionSamples, 1 );
+            best = std::min( best, value );
+            return Box{ bound( BasicInterval( a, b ), value ), a, b };
+        };
+
+        // Min-heap by bound, so the front box holds the lowest bound over the whole interval.
+        auto compare = []( const Box &a, const Box &b ) { return a.bound > b.bound; };
+
+        std::pmr::vector<Box> boxes( memory_resource() );
+        boxes.push_back( make_box( min(), max() ) );
+
+        for ( size_t iteration = 0; !boxes.empty(); ++iteration )
+        {
+            const Box &lowest = boxes.front();
+
+            if ( best - lowest.bound <= tolerance || iteration == max_iterations )
+                return std::min( lowest.bound, best );
+
+            std::pop_heap( boxes.begin(), boxes.end(), compare );
+            Box box = std::move( boxes.back() );
+            boxes.pop_back();
+
+            T mid = box.min + ( box.max - box.min ) / T( 2 );
+
+            for ( Box child : { make_box( box.min, mid ), make_box( mid, box.max ) } )
+            {
+                // Boxes with bound not below the best value cannot contain a lower value.
+                if ( child.bound < best )
+                {
+                    boxes.push_back( std::move( child ) );
+                    std::push_heap( boxes.begin(), boxes.end(), compare );
+                }
+            }
+        }
+
+        return best;
+    }
+
+    template <typename T>
+    template <typename F>
+    BasicInterval<T> BasicInterval<T>::sample_function( F &func, size_t first, size_t last,
+                                                        size_t number_elements ) const
+    {
+        T lower = func( min() + T( first ) / T( number_elements ) * ( max() - min() ) );
+        T upper = lower;
+
+        // Generate values between start and end (inclusive)
+        for ( size_t i = first + 1; i <= last; ++i )
+        {
+            T t = T( i ) / T( number_elements );
+            T x = min() + t * ( max() - min() );
+            T value = func( x );
+
+            if ( value < lower )
+                lower = value;
+            if ( value > upper )
+                upper = value;
+        }
+
+        return BasicInterval( lower, upper );
+    }
+
+    using Interval = BasicInterval<PreciseFloat>;
+
+    extern template class DLL_API BasicInterval<PreciseFloat>;
+    extern template class DLL_API BasicInterval<double>;
+    extern template class DLL_API BasicInterval<long double>;
+#ifdef FUZZYMATH_HAS_FLOAT128
+    extern template class DLL_API BasicInterval<QuadFloat>;
+#endif
+
 } // namespace FuzzyMath
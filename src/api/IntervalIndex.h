@@ -0,0 +1,63 @@
+#pragma once
+
+#include <span>
+#include <vector>
+
+#include "FuzzyMath.h"
+#include "FuzzyNumber.h"
+#include "Interval.h"
+#include "Types.h"
+
+namespace FuzzyMath
+{
+    // Immutable interval tree over alpha cuts of fuzzy numbers at fixed alpha levels, by default over supports (alpha
+    // 0) and kernels (alpha 1). Cuts of every level are sorted by lower bounds and packed into contiguous arrays, which
+    // are read as an implicit binary tree in in-order layout, each node keeping the maximum upper bound of its subtree.
+    // Stabbing and overlap queries take O(log n + k) for k reported cuts. Queries return indices of numbers in
+    // ascending order and throw std::invalid_argument for an alpha level that is not indexed.
+    template <typename T>
+    class BasicIntervalIndex
+    {
+      public:
+        explicit BasicIntervalIndex( std::span<const BasicFuzzyNumber<T>> numbers,
+                                     std::vector<T> alpha_levels = { T( 0 ), T( 1 ) } );
+
+        size_t size() const;
+        std::span<const T> alpha_levels() const;
+
+        // Numbers whose alpha cut contains value.
+        std::vector<size_t> stabbing( const T &value, const T &alpha = T( 0 ) ) const;
+        // Numbers whose alpha cut intersects window.
+        std::vector<size_t> overlapping( const BasicInterval<T> &window, const T &alpha = T( 0 ) ) const;
+        // Numbers whose alpha cut lies inside window.
+        std::vector<size_t> contained( const BasicInterval<T> &window, const T &alpha = T( 1 ) ) const;
+
+      private:
+        std::vector<T> m_levels;
+        size_t m_count = 0;
+        // Height of the root of the implicit tree, node i has height equal to the number of trailing ones of i.
+        size_t m_height = 0;
+
+        // Level-major arrays of m_levels.size() x m_count elements, sorted by lower bounds within every level.
+        std::vector<T> m_lower;
+        std::vector<T> m_upper;
+        std::vector<T> m_maximum;
+        std::vector<size_t> m_numbers;
+
+        // Offset of arrays of alpha level.
+        size_t level_offset( const T &alpha ) const;
+
+        // Calls report( position ) for every cut of level at offset that intersects [min, max].
+        template <typename F>
+        void search( size_t offset, const T &min, const T &max, F &&report ) const;
+    };
+
+    using IntervalIndex = BasicIntervalIndex<PreciseFloat>;
+
+    extern template class DLL_API BasicIntervalIndex<PreciseFloat>;
+    extern template class DLL_API BasicIntervalIndex<double>;
+    extern template class DLL_API BasicIntervalIndex<long double>;
+#ifdef FUZZYMATH_HAS_FLOAT128
+    extern template class DLL_API BasicIntervalIndex<QuadFloat>;
+#endif
+} // namespace FuzzyMath
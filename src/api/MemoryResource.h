@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+
+#include "FuzzyMath.h"
+
+namespace FuzzyMath
+{
+    // Memory resource of the calling thread, used for alpha cuts of fuzzy numbers and temporary buffers of arithmetic
+    // and function application. It is std::pmr::get_default_resource() unless replaced by ScopedMemoryResource.
+    //
+    // Copies of fuzzy numbers are allocated from the default resource, as usual for std::pmr containers, so a result is
+    // taken out of a scope by copying it. Moved fuzzy numbers keep their resource and must not outlive it.
+    DLL_API std::pmr::memory_resource *memory_resource();
+
+    // Replaces memory resource of the calling thread for its lifetime. Scopes can be nested.
+    class DLL_API ScopedMemoryResource
+    {
+      public:
+        explicit ScopedMemoryResource( std::pmr::memory_resource *resource );
+        ~ScopedMemoryResource();
+
+        ScopedMemoryResource( const ScopedMemoryResource & ) = delete;
+        ScopedMemoryResource &operator=( const ScopedMemoryResource & ) = delete;
+
+      private:
+        std::pmr::memory_resource *m_previous;
+    };
+
+    // Monotonic arena for evaluation of one request on the calling thread. Everything allocated while the arena exists
+    // is released at once when it is destroyed, so fuzzy numbers created in its scope must be copied to be kept.
+    class DLL_API ScopedArena
+    {
+      public:
+        explicit ScopedArena( size_t initial_size = 64 * 1024,
+                              std::pmr::memory_resource *upstream = std::pmr::get_default_resource() );
+
+        ScopedArena( const ScopedArena & ) = delete;
+        ScopedArena &operator=( const ScopedArena & ) = delete;
+
+        std::pmr::memory_resource *resource();
+
+      private:
+        // Declared first, so the buffer is released only after the previous resource is restored.
+        std::pmr::monotonic_buffer_resource m_buffer;
+        ScopedMemoryResource m_scope;
+    };
+} // namespace FuzzyMath
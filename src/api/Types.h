@@ -1,8 +1,72 @@
 #pragma once
 
+#include <concepts>
+#include <cstdlib>
+#include <functional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
 #include <boost/multiprecision/cpp_dec_float.hpp>
 
+#ifdef FUZZYMATH_HAS_FLOAT128
+#include <boost/multiprecision/float128.hpp>
+#endif
+
 namespace FuzzyMath
 {
     using PreciseFloat = boost::multiprecision::cpp_dec_float_50;
-}
\ No newline at end of file
+
+#ifdef FUZZYMATH_HAS_FLOAT128
+    // Wrapper around __float128 that provides numeric_limits, streaming and math functions.
+    using QuadFloat = boost::multiprecision::float128;
+#endif
+
+    // Parse number of type T from string. Hardware floating point types do not have string constructor, so they use
+    // strtold and throw std::runtime_error (the same exception as boost::multiprecision) on invalid input.
+    template <typename T>
+    T number_from_string( const std::string &value )
+    {
+        if constexpr ( std::is_floating_point_v<T> )
+        {
+            const char *begin = value.c_str();
+            char *end = nullptr;
+            long double result = std::strtold( begin, &end );
+
+            if ( end == begin || *end != '\0' )
+            {
+                throw std::runtime_error( "Unable to parse number from string: " + value );
+            }
+
+            return static_cast<T>( result );
+        }
+        else
+        {
+            return T( value );
+        }
+    }
+
+    // Convert integral, floating point or string value into number of type T.
+    template <typename T, typename U>
+    T to_number( const U &value )
+    {
+        if constexpr ( std::is_convertible_v<U, std::string> )
+        {
+            return number_from_string<T>( std::string( value ) );
+        }
+        else
+        {
+            return T( value );
+        }
+    }
+
+    // Callable mapping number of type T to value convertible to T, such as function applied to intervals.
+    template <typename F, typename T>
+    concept RealFunction = std::invocable<F, const T &> && std::convertible_to<std::invoke_result_t<F, const T &>, T>;
+
+    // Callable mapping several numbers of type T, passed as a span, to value convertible to T.
+    template <typename F, typename T>
+    concept MultivariateRealFunction = std::invocable<F, std::span<const T>> &&
+                                       std::convertible_to<std::invoke_result_t<F, std::span<const T>>, T>;
+} // namespace FuzzyMath
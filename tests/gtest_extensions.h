@@ -8,9 +8,21 @@
 
 namespace FuzzyMath
 {
-    inline void PrintTo( const Interval &i, std::ostream *os ) { *os << i.to_string(); }
+    template <typename T>
+    inline void PrintTo( const BasicInterval<T> &i, std::ostream *os )
+    {
+        *os << i.to_string();
+    }
 
-    inline void PrintTo( const FuzzyNumber &fn, std::ostream *os ) { *os << fn.to_string(); }
+    template <typename T>
+    inline void PrintTo( const BasicFuzzyNumber<T> &fn, std::ostream *os )
+    {
+        *os << fn.to_string();
+    }
 
-    inline void PrintTo( const AlphaCut &ac, std::ostream *os ) { *os << ac.to_string(); }
+    template <typename T>
+    inline void PrintTo( const BasicAlphaCut<T> &ac, std::ostream *os )
+    {
+        *os << ac.to_string();
+    }
 } // namespace FuzzyMath
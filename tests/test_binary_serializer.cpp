@@ -0,0 +1,154 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <BinarySerializer.h>
+#include <FuzzyNumber.h>
+#include <FuzzyNumberFactory.h>
+
+#include "gtest_extensions.h"
+
+using namespace FuzzyMath;
+
+class BinarySerializerTests : public ::testing::Test
+{
+  protected:
+    PreciseFloat third = PreciseFloat( 1 ) / 3;
+    PreciseFloat seventh = PreciseFloat( -1 ) / 7;
+
+    Interval interval = Interval( seventh, third );
+    AlphaCut alpha_cut = AlphaCut( third, Interval( seventh, third ) );
+    FuzzyNumber fn_a = FuzzyNumberFactory::triangular( seventh, third, 2, 4 );
+    FuzzyNumber fn_b = FuzzyNumberFactory::trapezoidal( 1, 2, 3, 4 );
+};
+
+TEST_F( BinarySerializerTests, RoundTrip )
+{
+    std::vector<std::byte> data = BinarySerializer::serialize( interval );
+    EXPECT_EQ( data.size(),
+               BinarySerializer::header_size + 2 * BinarySerializer::value_size( BinaryEncoding::Native ) );
+
+    Interval read_interval = BinarySerializer::deserialize_interval( data );
+    EXPECT_EQ( read_interval.min(), seventh );
+    EXPECT_EQ( read_interval.max(), third );
+
+    AlphaCut read_alpha_cut = BinarySerializer::deserialize_alpha_cut( BinarySerializer::serialize( alpha_cut ) );
+    EXPECT_EQ( read_alpha_cut.alpha(), third );
+    EXPECT_EQ( read_alpha_cut, alpha_cut );
+
+    FuzzyNumber read_fuzzy_number = BinarySerializer::deserialize_fuzzy_number( BinarySerializer::serialize( fn_a ) );
+    EXPECT_EQ( read_fuzzy_number, fn_a );
+
+    // Equality of fuzzy numbers is tolerant, bit exact round trip is checked on every endpoint.
+    for ( size_t i = 0; i < fn_a.size(); ++i )
+    {
+        EXPECT_EQ( read_fuzzy_number.alpha_levels()[i], fn_a.alpha_levels()[i] );
+        EXPECT_EQ( read_fuzzy_number.lower_bounds()[i], fn_a.lower_bounds()[i] );
+        EXPECT_EQ( read_fuzzy_number.upper_bounds()[i], fn_a.upper_bounds()[i] );
+    }
+}
+
+TEST_F( BinarySerializerTests, Sequences )
+{
+    std::vector<FuzzyNumber> fuzzy_numbers = { fn_a, fn_b, fn_a };
+    std::vector<FuzzyNumber> read_fuzzy_numbers =
+        BinarySerializer::deserialize_fuzzy_numbers( BinarySerializer::serialize( std::span( fuzzy_numbers ) ) );
+    EXPECT_EQ( read_fuzzy_numbers, fuzzy_numbers );
+
+    std::vector<AlphaCut> alpha_cuts( fn_a.begin(), fn_a.end() );
+    EXPECT_EQ( BinarySerializer::deserialize_alpha_cuts( BinarySerializer::serialize( std::span( alpha_cuts ) ) ),
+               alpha_cuts );
+
+    std::vector<Interval> intervals;
+    EXPECT_TRUE(
+        BinarySerializer::deserialize_intervals( BinarySerializer::serialize( std::span( intervals ) ) ).empty() );
+
+    std::vector<std::byte> data = BinarySerializer::serialize( std::span( fuzzy_numbers ) );
+    EXPECT_THROW( BinarySerializer::deserialize_fuzzy_number( data ), std::invalid_argument );
+}
+
+TEST_F( BinarySerializerTests, DoubleEncoding )
+{
+    std::vector<std::byte> data = BinarySerializer::serialize( fn_b, BinaryEncoding::Double );
+    EXPECT_EQ( data.size(), BinarySerializer::header_size + 8 + 2 * 3 * sizeof( double ) );
+    EXPECT_EQ( BinarySerializer::deserialize_fuzzy_number( data ), fn_b );
+
+    BasicFuzzyNumber<double> read = BasicBinarySerializer<double>::deserialize_fuzzy_number( data );
+    EXPECT_EQ( read, BasicFuzzyNumberFactory<double>::trapezoidal( 1, 2, 3, 4 ) );
+
+    Interval read_interval =
+        BinarySerializer::deserialize_interval( BinarySerializer::serialize( interval, BinaryEncoding::Double ) );
+    EXPECT_EQ( read_interval.min(), PreciseFloat( static_cast<double>( seventh ) ) );
+
+    // Native encoding of PreciseFloat can not be read into other types.
+    EXPECT_THROW( BasicBinarySerializer<double>::deserialize_fuzzy_number( BinarySerializer::serialize( fn_b ) ),
+                  std::invalid_argument );
+}
+
+TEST( BinarySerializerTests_Standalone, HardwareBackends )
+{
+    using Serializer = BasicBinarySerializer<long double>;
+
+    BasicInterval<long double> interval( 1.0L / 3, 2.0L / 3 );
+    BasicInterval<long double> read = Serializer::deserialize_interval( Serializer::serialize( interval ) );
+
+    EXPECT_EQ( Serializer::value_size( BinaryEncoding::Native ), sizeof( long double ) );
+    EXPECT_EQ( read.min(), interval.min() );
+    EXPECT_EQ( read.max(), interval.max() );
+
+    BasicFuzzyNumber<double> fuzzy_number = BasicFuzzyNumberFactory<double>::triangular( 0.1, 0.2, 0.7, 6 );
+    EXPECT_EQ( BasicBinarySerializer<double>::deserialize_fuzzy_number(
+                   BasicBinarySerializer<double>::serialize( fuzzy_number ) ),
+               fuzzy_number );
+}
+
+TEST_F( BinarySerializerTests, Errors )
+{
+    std::vector<std::byte> data = BinarySerializer::serialize( fn_a );
+
+    std::vector<std::byte> bad_magic = data;
+    bad_magic[0] = std::byte( 'X' );
+    EXPECT_THROW( BinarySerializer::deserialize_fuzzy_number( bad_magic ), std::invalid_argument );
+
+    std::vector<std::byte> bad_version = data;
+    bad_version[4] = std::byte( 9 );
+    EXPECT_THROW( BinarySerializer::deserialize_fuzzy_number( bad_version ), std::invalid_argument );
+
+    EXPECT_THROW( BinarySerializer::deserialize_interval( data ), std::invalid_argument );
+    EXPECT_THROW( BinarySerializer::deserialize_fuzzy_number( std::span( data ).first( data.size() - 1 ) ),
+                  std::invalid_argument );
+    EXPECT_THROW( BinarySerializer::deserialize_fuzzy_number( std::span( data ).first( 10 ) ),
+                  std::invalid_argument );
+
+    std::vector<std::byte> trailing = data;
+    trailing.push_back( std::byte( 0 ) );
+    EXPECT_THROW( BinarySerializer::deserialize_fuzzy_number( trailing ), std::invalid_argument );
+
+    // Huge number of alpha cuts must not cause allocation.
+    std::vector<std::byte> huge_count = data;
+    huge_count[BinarySerializer::header_size + 7] = std::byte( 0x7F );
+    EXPECT_THROW( BinarySerializer::deserialize_fuzzy_number( huge_count ), std::invalid_argument );
+}
+
+TEST( BinarySerializerTests_Standalone, ValidationFail )
+{
+#ifdef FUZZYMATH_NO_VALIDATION
+    GTEST_SKIP() << "Validation is compiled out.";
+#endif
+
+    using Serializer = BasicBinarySerializer<double>;
+
+    std::vector<std::byte> data = Serializer::serialize( BasicFuzzyNumberFactory<double>::triangular( 1, 2, 3 ) );
+
+    // Swap lower bounds of both alpha cuts, which breaks nesting.
+    size_t lower = Serializer::header_size + 8 + 2 * sizeof( double );
+    std::swap_ranges( data.begin() + lower, data.begin() + lower + sizeof( double ),
+                      data.begin() + lower + sizeof( double ) );
+
+    EXPECT_THROW( Serializer::deserialize_fuzzy_number( data ), std::invalid_argument );
+}
+
+int main( int argc, char **argv )
+{
+    testing::InitGoogleTest( &argc, argv );
+    return RUN_ALL_TESTS();
+}
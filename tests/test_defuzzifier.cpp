@@ -0,0 +1,124 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include <Defuzzifier.h>
+#include <FuzzyNumber.h>
+#include <FuzzyNumberBatch.h>
+#include <FuzzyNumberFactory.h>
+
+#include "gtest_extensions.h"
+
+using namespace FuzzyMath;
+
+class DefuzzifierTests : public ::testing::Test
+{
+  protected:
+    FuzzyNumber fn_a = FuzzyNumberFactory::triangular( 0, 1, 2 );
+    FuzzyNumber fn_b = FuzzyNumberFactory::triangular( 0, 0, 3 );
+    FuzzyNumber fn_c = FuzzyNumberFactory::trapezoidal( 1, 2, 3, 6 );
+    FuzzyNumber fn_d = FuzzyNumberFactory::crisp_number( 4 );
+
+    // Divisions by 3 and 6 are not exact in decimal arithmetic.
+    static void expect_near( const PreciseFloat &value, const PreciseFloat &expected )
+    {
+        EXPECT_LT( abs( value - expected ), PreciseFloat( "1e-40" ) ) << value << " != " << expected;
+    }
+};
+
+TEST_F( DefuzzifierTests, SymmetricNumber )
+{
+    for ( DefuzzificationMethod method :
+          { DefuzzificationMethod::Centroid, DefuzzificationMethod::Bisector, DefuzzificationMethod::MeanOfMaxima,
+            DefuzzificationMethod::ExpectedValue, DefuzzificationMethod::GradedMean } )
+    {
+        expect_near( Defuzzifier::defuzzify( fn_a, method ), PreciseFloat( 1 ) );
+        expect_near( Defuzzifier::defuzzify( fn_d, method ), PreciseFloat( 4 ) );
+    }
+}
+
+TEST_F( DefuzzifierTests, Triangular )
+{
+    EXPECT_EQ( Defuzzifier::centroid( fn_b ), PreciseFloat( 1 ) );
+    EXPECT_EQ( Defuzzifier::mean_of_maxima( fn_b ), PreciseFloat( 0 ) );
+    EXPECT_EQ( Defuzzifier::expected_interval( fn_b ), Interval( 0, PreciseFloat( "1.5" ) ) );
+    EXPECT_EQ( Defuzzifier::expected_value( fn_b ), PreciseFloat( "0.75" ) );
+    expect_near( Defuzzifier::graded_mean( fn_b ), PreciseFloat( "0.5" ) );
+
+    // Area right of the bisector is ( 3 - x )^2 / 6, which is half of 1.5.
+    EXPECT_NEAR( Defuzzifier::bisector( fn_b ).convert_to<double>(), 3 - std::sqrt( 4.5 ), 1e-15 );
+}
+
+TEST_F( DefuzzifierTests, Trapezoidal )
+{
+    expect_near( Defuzzifier::centroid( fn_c ), PreciseFloat( 56 ) / 18 );
+    EXPECT_EQ( Defuzzifier::bisector( fn_c ), PreciseFloat( 3 ) );
+    EXPECT_EQ( Defuzzifier::mean_of_maxima( fn_c ), PreciseFloat( "2.5" ) );
+    EXPECT_EQ( Defuzzifier::expected_interval( fn_c ), Interval( PreciseFloat( "1.5" ), PreciseFloat( "4.5" ) ) );
+    EXPECT_EQ( Defuzzifier::expected_value( fn_c ), PreciseFloat( 3 ) );
+    expect_near( Defuzzifier::graded_mean( fn_c ), PreciseFloat( 17 ) / 6 );
+}
+
+TEST_F( DefuzzifierTests, Batch )
+{
+    std::vector<FuzzyNumber> numbers = { fn_a, fn_b, fn_c, fn_d };
+    FuzzyNumberBatch batch( numbers, 5 );
+
+    for ( DefuzzificationMethod method :
+          { DefuzzificationMethod::Centroid, DefuzzificationMethod::Bisector, DefuzzificationMethod::MeanOfMaxima,
+            DefuzzificationMethod::ExpectedValue, DefuzzificationMethod::GradedMean } )
+    {
+        std::vector<PreciseFloat> values = Defuzzifier::defuzzify( numbers, method );
+        std::vector<PreciseFloat> batch_values = Defuzzifier::defuzzify_batch( batch, method );
+
+        ASSERT_EQ( values.size(), numbers.size() );
+        ASSERT_EQ( batch_values.size(), numbers.size() );
+
+        for ( size_t i = 0; i < numbers.size(); ++i )
+        {
+            EXPECT_EQ( values[i], Defuzzifier::defuzzify( numbers[i], method ) );
+
+            // Batch samples linear branches at more alpha levels, which does not change the membership function.
+            expect_near( batch_values[i], values[i] );
+        }
+    }
+}
+
+TEST( DefuzzifierTests_Standalone, AgainstSampling )
+{
+    using Factory = BasicFuzzyNumberFactory<double>;
+
+    // Branches with different slopes between alpha levels.
+    BasicFuzzyNumber<double> fn = Factory::triangular( 1, 2, 4, 7 ).apply_function(
+        []( const double &x ) { return x * x; }, true );
+
+    // Midpoint rule on membership sampled at many points.
+    size_t samples = 200000;
+    double min = fn.min();
+    double step = ( fn.max() - min ) / samples;
+    double area = 0;
+    double moment = 0;
+    std::vector<double> cumulative;
+
+    for ( size_t i = 0; i < samples; ++i )
+    {
+        double x = min + ( i + 0.5 ) * step;
+        double membership = static_cast<double>( fn.membership( x ).as_double() );
+        area += membership * step;
+        moment += x * membership * step;
+        cumulative.push_back( area );
+    }
+
+    size_t half = std::lower_bound( cumulative.begin(), cumulative.end(), area / 2 ) - cumulative.begin();
+
+    EXPECT_NEAR( BasicDefuzzifier<double>::centroid( fn ), moment / area, 1e-6 );
+    EXPECT_NEAR( BasicDefuzzifier<double>::bisector( fn ), min + half * step, 2 * step );
+}
+
+int main( int argc, char **argv )
+{
+    testing::InitGoogleTest( &argc, argv );
+    return RUN_ALL_TESTS();
+}
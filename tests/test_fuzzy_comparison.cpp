@@ -0,0 +1,120 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <FuzzyComparison.h>
+#include <FuzzyNumber.h>
+#include <FuzzyNumberFactory.h>
+
+#include "gtest_extensions.h"
+
+using namespace FuzzyMath;
+
+class FuzzyComparisonTests : public ::testing::Test
+{
+  protected:
+    FuzzyNumber fn_a = FuzzyNumberFactory::triangular( 1, 2, 3 );
+    FuzzyNumber fn_b = FuzzyNumberFactory::triangular( 2, 3, 4 );
+    FuzzyNumber fn_c = FuzzyNumberFactory::triangular( 5, 6, 7, 5 );
+    FuzzyNumber fn_d = FuzzyNumberFactory::trapezoidal( 0, 2, 3, 6, 3 );
+
+    static PossibilisticMembership membership( const char *possibility, const char *necessity )
+    {
+        return PossibilisticMembership( PreciseFloat( possibility ), PreciseFloat( necessity ) );
+    }
+};
+
+TEST_F( FuzzyComparisonTests, IdenticalNumbers )
+{
+    EXPECT_EQ( FuzzyComparison::greater_or_equal( fn_a, fn_a ), membership( "1", "0.5" ) );
+    EXPECT_EQ( FuzzyComparison::greater( fn_a, fn_a ), membership( "0.5", "0" ) );
+
+    FuzzyNumber crisp = FuzzyNumberFactory::crisp_number( 2 );
+
+    EXPECT_EQ( FuzzyComparison::greater_or_equal( crisp, crisp ), membership( "1", "1" ) );
+    EXPECT_EQ( FuzzyComparison::greater( crisp, crisp ), membership( "0", "0" ) );
+}
+
+TEST_F( FuzzyComparisonTests, OverlappingNumbers )
+{
+    EXPECT_EQ( FuzzyComparison::greater_or_equal( fn_a, fn_b ), membership( "0.5", "0" ) );
+    EXPECT_EQ( FuzzyComparison::greater( fn_a, fn_b ), membership( "0", "0" ) );
+
+    EXPECT_EQ( FuzzyComparison::greater_or_equal( fn_b, fn_a ), membership( "1", "1" ) );
+    EXPECT_EQ( FuzzyComparison::greater( fn_b, fn_a ), membership( "1", "0.5" ) );
+
+    EXPECT_EQ( FuzzyComparison::compare( fn_b, fn_a, Dominance::Greater ), FuzzyComparison::greater( fn_b, fn_a ) );
+    EXPECT_EQ( FuzzyComparison::compare( fn_b, fn_a, Dominance::GreaterOrEqual ),
+               FuzzyComparison::greater_or_equal( fn_b, fn_a ) );
+
+    // Necessity never exceeds possibility.
+    for ( const FuzzyNumber &x : { fn_a, fn_b, fn_d } )
+    {
+        for ( const FuzzyNumber &y : { fn_a, fn_b, fn_d } )
+        {
+            PossibilisticMembership weak = FuzzyComparison::greater_or_equal( x, y );
+            PossibilisticMembership strict = FuzzyComparison::greater( x, y );
+
+            EXPECT_LE( weak.necessity(), weak.possibility() );
+            EXPECT_LE( strict.necessity(), strict.possibility() );
+            EXPECT_LE( strict.possibility(), weak.possibility() );
+            EXPECT_LE( strict.necessity(), weak.necessity() );
+        }
+    }
+}
+
+TEST_F( FuzzyComparisonTests, DisjointSupports )
+{
+    EXPECT_EQ( FuzzyComparison::greater_or_equal( fn_c, fn_a ), membership( "1", "1" ) );
+    EXPECT_EQ( FuzzyComparison::greater( fn_c, fn_a ), membership( "1", "1" ) );
+    EXPECT_EQ( FuzzyComparison::greater_or_equal( fn_a, fn_c ), membership( "0", "0" ) );
+    EXPECT_EQ( FuzzyComparison::greater( fn_a, fn_c ), membership( "0", "0" ) );
+}
+
+TEST_F( FuzzyComparisonTests, DominanceMatrix )
+{
+    std::vector<FuzzyNumber> numbers = { fn_a, fn_b, fn_c, fn_d, fn_a, FuzzyNumberFactory::crisp_number( 3 ) };
+    size_t count = numbers.size();
+
+    for ( Dominance relation : { Dominance::GreaterOrEqual, Dominance::Greater } )
+    {
+        std::vector<PossibilisticMembership> matrix = FuzzyComparison::dominance_matrix( numbers, relation, 1 );
+
+        ASSERT_EQ( matrix.size(), count * count );
+        for ( size_t row = 0; row < count; ++row )
+        {
+            for ( size_t column = 0; column < count; ++column )
+            {
+                EXPECT_EQ( matrix[row * count + column],
+                           FuzzyComparison::compare( numbers[row], numbers[column], relation ) );
+            }
+        }
+
+        EXPECT_EQ( FuzzyComparison::dominance_matrix( numbers, relation, 4 ), matrix );
+        EXPECT_EQ( FuzzyComparison::dominance_matrix( numbers, relation, 100 ), matrix );
+    }
+
+    EXPECT_TRUE( FuzzyComparison::dominance_matrix( std::vector<FuzzyNumber>() ).empty() );
+}
+
+TEST( FuzzyComparisonTests_Standalone, HardwareBackends )
+{
+    using Factory = BasicFuzzyNumberFactory<double>;
+
+    BasicFuzzyNumber<double> a = Factory::triangular( 1, 2, 3 );
+    BasicFuzzyNumber<double> b = Factory::triangular( 2, 3, 4 );
+
+    PossibilisticMembership result = BasicFuzzyComparison<double>::greater( b, a );
+    EXPECT_EQ( result.possibility(), PreciseFloat( 1 ) );
+    EXPECT_EQ( result.necessity(), PreciseFloat( "0.5" ) );
+
+    std::vector<BasicFuzzyNumber<double>> numbers = { a, b };
+    EXPECT_EQ( BasicFuzzyComparison<double>::dominance_matrix( numbers, Dominance::Greater, 2 )[2], result );
+}
+
+int main( int argc, char **argv )
+{
+    testing::InitGoogleTest( &argc, argv );
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,143 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <FuzzyDistance.h>
+#include <FuzzyNumber.h>
+#include <FuzzyNumberFactory.h>
+#include <FuzzyNumberIndex.h>
+
+#include "gtest_extensions.h"
+
+using namespace FuzzyMath;
+
+class FuzzyDistanceTests : public ::testing::Test
+{
+  protected:
+    FuzzyNumber fn_a = FuzzyNumberFactory::triangular( 1, 2, 3 );
+    FuzzyNumber fn_b = FuzzyNumberFactory::triangular( 2, 3, 4 );
+    FuzzyNumber fn_c = FuzzyNumberFactory::triangular( 0, 1, 2 );
+    FuzzyNumber fn_d = FuzzyNumberFactory::triangular( -1, 1, 3, 5 );
+
+    // Square roots and divisions by 3 are not exact in decimal arithmetic.
+    static void expect_near( const PreciseFloat &value, const PreciseFloat &expected )
+    {
+        EXPECT_LT( abs( value - expected ), PreciseFloat( "1e-40" ) ) << value << " != " << expected;
+    }
+};
+
+TEST_F( FuzzyDistanceTests, Shift )
+{
+    EXPECT_EQ( FuzzyDistance::hausdorff( fn_a, fn_b ), PreciseFloat( 1 ) );
+    expect_near( FuzzyDistance::l2( fn_a, fn_b ), sqrt( PreciseFloat( 2 ) ) );
+    expect_near( FuzzyDistance::bertoluzza( fn_a, fn_b ), PreciseFloat( 1 ) );
+    expect_near( FuzzyDistance::bertoluzza( fn_a, fn_b, PreciseFloat( 2 ) ), PreciseFloat( 1 ) );
+}
+
+TEST_F( FuzzyDistanceTests, Spread )
+{
+    // Bounds differ by 1 - alpha in opposite directions, midpoints are the same.
+    EXPECT_EQ( FuzzyDistance::hausdorff( fn_c, fn_d ), PreciseFloat( 1 ) );
+    expect_near( FuzzyDistance::l2( fn_c, fn_d ), sqrt( PreciseFloat( 2 ) / 3 ) );
+    expect_near( FuzzyDistance::bertoluzza( fn_c, fn_d ), PreciseFloat( 1 ) / 3 );
+    expect_near( FuzzyDistance::bertoluzza( fn_c, fn_d, PreciseFloat( 1 ) ), sqrt( PreciseFloat( 1 ) / 3 ) );
+
+    EXPECT_THROW( FuzzyDistance::bertoluzza( fn_c, fn_d, PreciseFloat( 0 ) ), std::invalid_argument );
+}
+
+TEST_F( FuzzyDistanceTests, Properties )
+{
+    // Same number with different alpha levels.
+    FuzzyNumber refined = FuzzyNumberFactory::triangular( 0, 1, 2, 7 );
+
+    for ( DistanceMetric metric : { DistanceMetric::Hausdorff, DistanceMetric::L2, DistanceMetric::Bertoluzza } )
+    {
+        EXPECT_EQ( FuzzyDistance::distance( fn_c, refined, metric ), PreciseFloat( 0 ) );
+        EXPECT_EQ( FuzzyDistance::distance( fn_a, fn_d, metric ), FuzzyDistance::distance( fn_d, fn_a, metric ) );
+        EXPECT_LE( FuzzyDistance::distance( fn_a, fn_d, metric ),
+                   FuzzyDistance::distance( fn_a, fn_b, metric ) + FuzzyDistance::distance( fn_b, fn_d, metric ) );
+    }
+}
+
+TEST_F( FuzzyDistanceTests, Index )
+{
+    FuzzyNumberIndex index( { fn_a, fn_b, fn_c, fn_d } );
+
+    EXPECT_EQ( index.size(), 4 );
+    EXPECT_EQ( index.metric(), DistanceMetric::L2 );
+    EXPECT_EQ( index[1], fn_b );
+
+    std::vector<FuzzyNumberIndex::Neighbour> nearest = index.nearest( fn_a, 2 );
+    ASSERT_EQ( nearest.size(), 2 );
+    EXPECT_EQ( nearest[0], ( FuzzyNumberIndex::Neighbour{ 0, PreciseFloat( 0 ) } ) );
+    EXPECT_EQ( nearest[1].index, 1 );
+
+    // fn_b and fn_c are shifts of fn_a in opposite directions, ties are ordered by index.
+    std::vector<FuzzyNumberIndex::Neighbour> within = index.within( fn_a, FuzzyDistance::l2( fn_a, fn_b ) );
+    ASSERT_EQ( within.size(), 3 );
+    EXPECT_EQ( within[1].index, 1 );
+    EXPECT_EQ( within[2].index, 2 );
+
+    EXPECT_EQ( index.nearest( fn_a, 10 ).size(), 4 );
+    EXPECT_TRUE( index.nearest( fn_a, 0 ).empty() );
+    EXPECT_TRUE( index.within( fn_a, PreciseFloat( -1 ) ).empty() );
+    EXPECT_TRUE( FuzzyNumberIndex( {} ).nearest( fn_a, 3 ).empty() );
+}
+
+TEST( FuzzyDistanceTests_Standalone, IndexAgainstBruteForce )
+{
+    using Factory = BasicFuzzyNumberFactory<double>;
+    using Index = BasicFuzzyNumberIndex<double>;
+
+    std::mt19937 generator( 42 );
+    std::uniform_real_distribution<double> position( -10, 10 );
+    std::uniform_real_distribution<double> width( 0, 2 );
+
+    auto random_number = [&]()
+    {
+        double kernel_minimum = position( generator );
+        double kernel_maximum = kernel_minimum + width( generator );
+        double minimum = kernel_minimum - width( generator );
+        double maximum = kernel_maximum + width( generator );
+        return Factory::trapezoidal( minimum, kernel_minimum, kernel_maximum, maximum, 2 + generator() % 4 );
+    };
+
+    std::vector<BasicFuzzyNumber<double>> library;
+    for ( int i = 0; i < 500; ++i )
+        library.push_back( random_number() );
+
+    for ( DistanceMetric metric : { DistanceMetric::Hausdorff, DistanceMetric::L2, DistanceMetric::Bertoluzza } )
+    {
+        Index index( library, metric );
+
+        for ( int query_number = 0; query_number < 20; ++query_number )
+        {
+            BasicFuzzyNumber<double> query = random_number();
+
+            std::vector<Index::Neighbour> expected;
+            for ( size_t i = 0; i < library.size(); ++i )
+                expected.push_back( { i, BasicFuzzyDistance<double>::distance( query, library[i], metric ) } );
+
+            std::sort( expected.begin(), expected.end(),
+                       []( const Index::Neighbour &a, const Index::Neighbour &b )
+                       { return a.distance < b.distance || ( a.distance == b.distance && a.index < b.index ); } );
+
+            std::vector<Index::Neighbour> nearest( expected.begin(), expected.begin() + 7 );
+            EXPECT_EQ( index.nearest( query, 7 ), nearest );
+
+            double radius = 2;
+            auto end = std::find_if( expected.begin(), expected.end(),
+                                     [radius]( const Index::Neighbour &n ) { return n.distance > radius; } );
+            EXPECT_EQ( index.within( query, radius ), std::vector<Index::Neighbour>( expected.begin(), end ) );
+        }
+    }
+}
+
+int main( int argc, char **argv )
+{
+    testing::InitGoogleTest( &argc, argv );
+    return RUN_ALL_TESTS();
+}
@@ -3,6 +3,7 @@
 
 #include <cmath>
 #include <limits>
+#include <thread>
 
 #include <Functions.h>
 #include <FuzzyNumber.h>
@@ -24,6 +25,10 @@ class FuzzyNumbersTests : public ::testing::Test
 
 TEST( FuzzyNumbersTests_Standalone, CreationFail )
 {
+#ifdef FUZZYMATH_NO_VALIDATION
+    GTEST_SKIP() << "Validation is compiled out.";
+#endif
+
     std::set<AlphaCut> alphas_cuts_1 = { AlphaCut( 0, Interval( 1, 1 ) ) };
     std::set<AlphaCut> alphas_cuts_2 = { AlphaCut( 0.1, Interval( 1, 1 ) ), AlphaCut( 1, Interval( 1.5, 1.5 ) ) };
     std::set<AlphaCut> alphas_cuts_3 = { AlphaCut( 0, Interval( 1, 1 ) ), AlphaCut( 0.5, Interval( 1.5, 1.5 ) ) };
@@ -33,6 +38,49 @@ TEST( FuzzyNumbersTests_Standalone, CreationFail )
     EXPECT_THROW( FuzzyNumber{ alphas_cuts_2 }, std::invalid_argument );
     EXPECT_THROW( FuzzyNumber{ alphas_cuts_3 }, std::invalid_argument );
     EXPECT_THROW( FuzzyNumber{ alphas_cuts_4 }, std::invalid_argument );
+
+    std::vector<PreciseFloat> alphas = { 0, 1 };
+
+    EXPECT_THROW( FuzzyNumber( alphas, { 1 }, { 2, 2 } ), std::invalid_argument );
+    EXPECT_THROW( FuzzyNumber( { 0, 1, 1 }, { 1, 1, 1 }, { 2, 2, 2 } ), std::invalid_argument );
+    EXPECT_THROW( FuzzyNumber( alphas, { 1, 3 }, { 2, 2 } ), std::invalid_argument );
+    EXPECT_THROW( FuzzyNumber( alphas, { 1, 0 }, { 2, 2 } ), std::invalid_argument );
+}
+
+TEST( FuzzyNumbersTests_Standalone, CreationFromColumns )
+{
+    std::vector<PreciseFloat> alphas = { 0, PreciseFloat( "0.5" ), 1 };
+    std::vector<PreciseFloat> lower = { 1, 2, 3 };
+    std::vector<PreciseFloat> upper = { 6, 5, 4 };
+
+    FuzzyNumber fn = FuzzyNumber( alphas, lower, upper );
+    EXPECT_EQ( fn.alpha_cut( PreciseFloat( "0.5" ) ).interval(), Interval( 2, 5 ) );
+    EXPECT_EQ( fn, FuzzyNumber( already_validated, alphas, lower, upper ) );
+
+    // Columns in storage of fuzzy number are moved in, not copied.
+    FuzzyNumber::storage_type lower_storage( lower.begin(), lower.end(), memory_resource() );
+    FuzzyNumber::storage_type upper_storage( upper.begin(), upper.end(), memory_resource() );
+    const PreciseFloat *data = lower_storage.data();
+    FuzzyNumber moved = FuzzyNumber( FuzzyNumber::storage_type( alphas.begin(), alphas.end(), memory_resource() ),
+                                     std::move( lower_storage ), std::move( upper_storage ) );
+    EXPECT_EQ( moved.lower_bounds().data(), data );
+    EXPECT_EQ( moved, fn );
+
+    FuzzyNumber other = std::move( moved );
+    EXPECT_EQ( other.lower_bounds().data(), data );
+}
+
+TEST_F( FuzzyNumbersTests, Factory )
+{
+    EXPECT_EQ( fn_d.kernel(), Interval( 2, 3 ) );
+    EXPECT_EQ( fn_d.support(), Interval( 1, 4 ) );
+
+    EXPECT_EQ( fn_e.cut_at( 2 ), AlphaCut( PreciseFloat( "0.4" ), Interval( "1.4", "2.6" ) ) );
+    EXPECT_EQ( fn_e.kernel(), Interval( PreciseFloat( 2 ) ) );
+
+    FuzzyNumber fn = FuzzyNumberFactory::trapezoidal( 0, 2, 3, 7, 5 );
+    EXPECT_EQ( fn.cut_at( 1 ), AlphaCut( PreciseFloat( "0.25" ), Interval( "0.5", "6" ) ) );
+    EXPECT_EQ( FuzzyNumberFactory::crisp_number( 2.0 ).support(), Interval( PreciseFloat( 2 ) ) );
 }
 
 TEST_F( FuzzyNumbersTests, AlphaCut )
@@ -64,6 +112,28 @@ TEST_F( FuzzyNumbersTests, GetAlphaCutsValues )
     EXPECT_EQ( alphas[5], PreciseFloat( "1" ) );
 }
 
+TEST_F( FuzzyNumbersTests, IterateAlphaCuts )
+{
+    std::vector<AlphaCut> cuts( fn_d.begin(), fn_d.end() );
+    ASSERT_EQ( cuts.size(), fn_d.size() );
+    EXPECT_EQ( cuts.front(), AlphaCut( 0, Interval( 1, 4 ) ) );
+    EXPECT_EQ( cuts.back(), AlphaCut( 1, fn_d.kernel() ) );
+
+    size_t i = 0;
+    for ( const AlphaCut &cut : fn_e )
+    {
+        EXPECT_EQ( cut.alpha(), fn_e.alpha_levels()[i] );
+        EXPECT_EQ( cut.interval().min(), fn_e.lower_bounds()[i] );
+        EXPECT_EQ( cut.interval().max(), fn_e.upper_bounds()[i] );
+        i++;
+    }
+    EXPECT_EQ( i, fn_e.size() );
+
+    EXPECT_EQ( fn_e.end() - fn_e.begin(), 6 );
+    EXPECT_EQ( fn_e.begin()[2].alpha(), PreciseFloat( "0.4" ) );
+    EXPECT_EQ( ( *std::prev( fn_e.end() ) ).alpha(), PreciseFloat( 1 ) );
+}
+
 TEST_F( FuzzyNumbersTests, Equality )
 {
     EXPECT_EQ( fn_a, FuzzyNumberFactory::triangular( 1, 2, 3 ) );
@@ -101,6 +171,56 @@ TEST_F( FuzzyNumbersTests, Addition )
     EXPECT_THROW( "invalid" + fn_a, std::runtime_error );
 }
 
+TEST_F( FuzzyNumbersTests, MergedAlphaLevels )
+{
+    FuzzyNumber fn_g = FuzzyNumber( { AlphaCut( 0, Interval( 1, 5 ) ),
+                                      AlphaCut( PreciseFloat( "0.4" ), Interval( 2, 4 ) ),
+                                      AlphaCut( 1, Interval( 3, 3 ) ) } );
+    FuzzyNumber fn_h = FuzzyNumber( { AlphaCut( 0, Interval( 0, 2 ) ),
+                                      AlphaCut( PreciseFloat( "0.5" ), Interval( "0.5", "1.5" ) ),
+                                      AlphaCut( 1, Interval( 1, 1 ) ) } );
+
+    FuzzyNumber res = fn_g + fn_h;
+    std::vector<PreciseFloat> alphas = res.alphas();
+    ASSERT_EQ( alphas.size(), 4 );
+    EXPECT_EQ( alphas[1], PreciseFloat( "0.4" ) );
+    EXPECT_EQ( alphas[2], PreciseFloat( "0.5" ) );
+    EXPECT_EQ( res.alpha_cut( PreciseFloat( "0.4" ) ).interval(), Interval( "2.4", "5.6" ) );
+    EXPECT_EQ( res.alpha_cut( PreciseFloat( "0.5" ) ).interval(),
+               fn_g.alpha_cut( PreciseFloat( "0.5" ) ).interval() + Interval( "0.5", "1.5" ) );
+
+    res = fn_a + fn_g;
+    EXPECT_EQ( res.alphas(), fn_g.alphas() );
+    EXPECT_EQ( res.alpha_cut( PreciseFloat( "0.4" ) ).interval(), Interval( "3.4", "6.6" ) );
+}
+
+TEST_F( FuzzyNumbersTests, Expression )
+{
+    FuzzyNumber ab = fn_a + fn_b;
+    FuzzyNumber ab_d = ab * fn_d;
+    FuzzyNumber ab_d_c = ab_d - fn_c;
+    FuzzyNumber stepwise = ab_d_c / fn_b;
+
+    FuzzyNumber fused = ( ( fn_a + fn_b ) * fn_d - fn_c ) / fn_b;
+    EXPECT_EQ( fused, stepwise );
+
+    FuzzyNumber fn_g = FuzzyNumber( { AlphaCut( 0, Interval( 1, 5 ) ),
+                                      AlphaCut( PreciseFloat( "0.4" ), Interval( 2, 4 ) ),
+                                      AlphaCut( 1, Interval( 3, 3 ) ) } );
+    FuzzyNumber sum = fn_a + fn_g + fn_e;
+    EXPECT_EQ( sum.alphas(), fn_e.alphas() );
+    EXPECT_EQ( sum.alpha_cut( PreciseFloat( "0.4" ) ).interval(), Interval( "4.8", "9.2" ) );
+
+    auto expression = fn_a + FuzzyNumberFactory::triangular( 2, 3, 4 ) * 2 - fn_c;
+    EXPECT_EQ( expression, FuzzyNumberFactory::triangular( 4, 8, 12 ) );
+    EXPECT_EQ( -expression, FuzzyNumberFactory::triangular( -12, -8, -4 ) );
+    EXPECT_EQ( expression.evaluate(), expression.evaluate() );
+    EXPECT_EQ( 2 * ( fn_a - 1 ), FuzzyNumberFactory::triangular( 0, 2, 4 ) );
+
+    EXPECT_THROW( fn_a / ( fn_b - fn_b ), std::domain_error );
+    EXPECT_THROW( ( fn_a + fn_b ) / 0, std::domain_error );
+}
+
 TEST_F( FuzzyNumbersTests, Substraction )
 {
     EXPECT_EQ( fn_a - fn_b, FuzzyNumberFactory::triangular( -3, -1, 1 ) );
@@ -116,6 +236,28 @@ TEST_F( FuzzyNumbersTests, Substraction )
     EXPECT_EQ( "1.5" - fn_a, FuzzyNumberFactory::triangular( -1.5, -0.5, 0.5 ) );
 }
 
+TEST_F( FuzzyNumbersTests, ScalarMultiplication )
+{
+    EXPECT_EQ( fn_d * 2, FuzzyNumberFactory::trapezoidal( 2, 4, 6, 8 ) );
+    EXPECT_EQ( fn_d * -2, FuzzyNumberFactory::trapezoidal( -8, -6, -4, -2 ) );
+    EXPECT_EQ( -2 * fn_d, FuzzyNumberFactory::trapezoidal( -8, -6, -4, -2 ) );
+    EXPECT_EQ( fn_d / -2, FuzzyNumberFactory::trapezoidal( -2, -1.5, -1, -0.5 ) );
+    EXPECT_EQ( fn_d * 0, FuzzyNumberFactory::crisp_number( 0.0 ) );
+    EXPECT_EQ( ( fn_a + fn_b ) * -1 + 10, FuzzyNumberFactory::triangular( 3, 5, 7 ) );
+
+    FuzzyNumber fn = fn_d;
+    fn *= PreciseFloat( -2 );
+    EXPECT_EQ( fn, FuzzyNumberFactory::trapezoidal( -8, -6, -4, -2 ) );
+    fn += PreciseFloat( 8 );
+    EXPECT_EQ( fn, FuzzyNumberFactory::trapezoidal( 0, 2, 4, 6 ) );
+    fn /= PreciseFloat( 2 );
+    fn -= PreciseFloat( 1 );
+    EXPECT_EQ( fn, FuzzyNumberFactory::trapezoidal( -1, 0, 1, 2 ) );
+
+    EXPECT_THROW( fn /= PreciseFloat( 0 ), std::domain_error );
+    EXPECT_THROW( 2 / fn_c, std::domain_error );
+}
+
 TEST_F( FuzzyNumbersTests, Division )
 {
     EXPECT_EQ( fn_a / 2, FuzzyNumberFactory::triangular( 0.5, 1, 1.5 ) );
@@ -166,6 +308,184 @@ TEST_F( FuzzyNumbersTests, Function )
     EXPECT_EQ( res2.kernel_max(), PreciseFloat( 4 ) );
 }
 
+TEST_F( FuzzyNumbersTests, FunctionBounded )
+{
+    auto square = []( const PreciseFloat &x ) { return x * x; };
+    auto square_extension = []( const Interval &box ) { return box.power( 2 ); };
+    PreciseFloat tolerance = PreciseFloat( "1e-6" );
+
+    FuzzyNumber res = fn_c.apply_function_bounded( square, square_extension, tolerance );
+
+    EXPECT_LE( res.min(), PreciseFloat( 0 ) );
+    EXPECT_GE( res.min(), -tolerance );
+    EXPECT_EQ( res.max(), PreciseFloat( 1 ) );
+    EXPECT_EQ( res.kernel(), Interval( PreciseFloat( 0 ) ) );
+
+    // Lipschitz bounds converge slowly at a flat minimum, so they are used with coarser tolerance.
+    tolerance = PreciseFloat( "1e-3" );
+    FuzzyNumber res1 = fn_c.apply_function_lipschitz( square, 2, tolerance );
+
+    EXPECT_LE( res1.min(), PreciseFloat( 0 ) );
+    EXPECT_GE( res1.min(), -tolerance );
+    EXPECT_GE( res1.max(), PreciseFloat( 1 ) );
+    EXPECT_LE( res1.max(), 1 + tolerance );
+    EXPECT_TRUE( res1.support().contains( res1.kernel() ) );
+}
+
+TEST_F( FuzzyNumbersTests, FunctionOfSeveralArguments )
+{
+    auto linear = []( std::span<const PreciseFloat> x ) { return x[0] * x[1] + x[2]; };
+
+    FuzzyNumber res = apply_function( linear, { fn_a, fn_b, fn_a }, true );
+
+    EXPECT_EQ( res, FuzzyNumber( fn_a * fn_b + fn_a ) );
+    EXPECT_EQ( apply_function( linear, { fn_a, fn_b, fn_a }, true, 0, 1 ), res );
+
+    // Repeated argument is evaluated as one variable, unlike in interval arithmetic.
+    auto quadratic = []( std::span<const PreciseFloat> x ) { return x[0] * x[0] - x[0]; };
+
+    FuzzyNumber res1 = apply_function( quadratic, { fn_c }, false, 100, 4 );
+
+    EXPECT_EQ( res1.min(), PreciseFloat( "-0.25" ) );
+    EXPECT_EQ( res1.max(), PreciseFloat( 2 ) );
+    EXPECT_EQ( res1.kernel(), Interval( PreciseFloat( 0 ) ) );
+    EXPECT_EQ( apply_function( quadratic, { fn_c }, false, 100, 1 ), res1 );
+
+    FuzzyNumber fn_g = FuzzyNumber( { AlphaCut( 0, Interval( 1, 5 ) ),
+                                      AlphaCut( PreciseFloat( "0.4" ), Interval( 2, 4 ) ),
+                                      AlphaCut( 1, Interval( 3, 3 ) ) } );
+    auto sum = []( std::span<const PreciseFloat> x ) { return x[0] + x[1]; };
+
+    EXPECT_EQ( apply_function( sum, { fn_a, fn_g }, true ), FuzzyNumber( fn_a + fn_g ) );
+
+    EXPECT_THROW( apply_function( sum, std::vector<FuzzyNumber>(), true ), std::invalid_argument );
+}
+
+TEST_F( FuzzyNumbersTests, Membership )
+{
+    EXPECT_EQ( fn_d.membership( 0 ), FuzzyMembership( PreciseFloat( 0 ) ) );
+    EXPECT_EQ( fn_d.membership( 1 ), FuzzyMembership( PreciseFloat( 0 ) ) );
+    EXPECT_EQ( fn_d.membership( PreciseFloat( "1.5" ) ), FuzzyMembership( "0.5" ) );
+    EXPECT_EQ( fn_d.membership( 2 ), FuzzyMembership( 1 ) );
+    EXPECT_EQ( fn_d.membership( PreciseFloat( "2.5" ) ), FuzzyMembership( 1 ) );
+    EXPECT_EQ( fn_d.membership( PreciseFloat( "3.75" ) ), FuzzyMembership( "0.25" ) );
+    EXPECT_EQ( fn_d.membership( 4 ), FuzzyMembership( PreciseFloat( 0 ) ) );
+    EXPECT_EQ( fn_d.membership( 5 ), FuzzyMembership( PreciseFloat( 0 ) ) );
+
+    // Membership of bounds of a cut is its alpha, also between cuts with different slopes.
+    FuzzyNumber fn_g = FuzzyNumber( { AlphaCut( 0, Interval( 1, 5 ) ),
+                                      AlphaCut( PreciseFloat( "0.4" ), Interval( 2, 4 ) ),
+                                      AlphaCut( 1, Interval( 3, 3 ) ) } );
+
+    EXPECT_EQ( fn_g.membership( 2 ), FuzzyMembership( "0.4" ) );
+    EXPECT_EQ( fn_g.membership( 4 ), FuzzyMembership( "0.4" ) );
+    EXPECT_EQ( fn_g.membership( PreciseFloat( "2.5" ) ), FuzzyMembership( "0.7" ) );
+    EXPECT_EQ( fn_g.membership( PreciseFloat( "1.5" ) ), FuzzyMembership( "0.2" ) );
+    EXPECT_EQ( fn_g.membership( 3 ), FuzzyMembership( 1 ) );
+}
+
+TEST_F( FuzzyNumbersTests, MembershipBatch )
+{
+    FuzzyNumber fn_g = FuzzyNumber( { AlphaCut( 0, Interval( 1, 5 ) ),
+                                      AlphaCut( PreciseFloat( "0.4" ), Interval( 2, 4 ) ),
+                                      AlphaCut( 1, Interval( 3, 3 ) ) } );
+
+    std::vector<PreciseFloat> sorted;
+    for ( int i = -4; i <= 28; ++i )
+        sorted.push_back( PreciseFloat( i ) / 4 );
+
+    std::vector<PreciseFloat> unsorted = sorted;
+    std::reverse( unsorted.begin(), unsorted.end() );
+    std::swap( unsorted[3], unsorted[20] );
+
+    for ( const FuzzyNumber &fn : { fn_d, fn_g } )
+    {
+        for ( const std::vector<PreciseFloat> &values : { sorted, unsorted } )
+        {
+            std::vector<FuzzyMembership> memberships = fn.membership( std::span<const PreciseFloat>( values ) );
+
+            ASSERT_EQ( memberships.size(), values.size() );
+            for ( size_t i = 0; i < values.size(); ++i )
+                EXPECT_EQ( memberships[i], fn.membership( values[i] ) );
+        }
+    }
+
+    EXPECT_TRUE( fn_d.membership( std::span<const PreciseFloat>() ).empty() );
+}
+
+TEST_F( FuzzyNumbersTests, Simplify )
+{
+    // Interior cuts of triangular fuzzy number are exactly on the line between alpha 0 and 1.
+    EXPECT_EQ( fn_e.size(), 6 );
+    EXPECT_EQ( fn_e.simplify( 0 ), fn_a );
+    EXPECT_EQ( fn_a.simplify( 1 ), fn_a );
+
+    FuzzyNumber fn = FuzzyNumberFactory::triangular( 1, 2, 3, 51 );
+    FuzzyNumber square = fn.apply_function( []( const PreciseFloat &x ) { return x * x; }, true );
+    PreciseFloat tolerance = PreciseFloat( "0.01" );
+
+    FuzzyNumber simplified = square.simplify( tolerance );
+
+    EXPECT_LT( simplified.size(), square.size() );
+    EXPECT_GT( simplified.size(), 2 );
+    EXPECT_EQ( simplified.support(), square.support() );
+    EXPECT_EQ( simplified.kernel(), square.kernel() );
+
+    for ( const AlphaCut &cut : square )
+    {
+        Interval interval = simplified.alpha_cut( cut.alpha() ).interval();
+
+        EXPECT_LE( abs( interval.min() - cut.interval().min() ), tolerance );
+        EXPECT_LE( abs( interval.max() - cut.interval().max() ), tolerance );
+    }
+
+    EXPECT_EQ( square.simplify( 100 ).size(), 2 );
+    EXPECT_THROW( square.simplify( -1 ), std::invalid_argument );
+}
+
+TEST_F( FuzzyNumbersTests, AutoSimplify )
+{
+    EXPECT_FALSE( FuzzyNumber::auto_simplify().has_value() );
+    EXPECT_EQ( FuzzyNumber( fn_e + fn_e ).size(), 6 );
+
+    FuzzyNumber::set_auto_simplify( PreciseFloat( 0 ) );
+
+    EXPECT_EQ( FuzzyNumber( fn_e + fn_e ), FuzzyNumberFactory::triangular( 2, 4, 6 ) );
+    EXPECT_EQ( fn_e.apply_function( []( const PreciseFloat &x ) -> PreciseFloat { return 2 * x; }, true ),
+               FuzzyNumberFactory::triangular( 2, 4, 6 ) );
+
+    // Setting is per thread.
+    std::thread( [this]() { EXPECT_EQ( FuzzyNumber( fn_e + fn_e ).size(), 6 ); } ).join();
+
+    FuzzyNumber::set_auto_simplify( std::nullopt );
+    EXPECT_EQ( FuzzyNumber( fn_e + fn_e ).size(), 6 );
+    EXPECT_THROW( FuzzyNumber::set_auto_simplify( PreciseFloat( -1 ) ), std::invalid_argument );
+}
+
+TEST( FuzzyNumbersTests_Standalone, HardwareBackends )
+{
+    using Factory = BasicFuzzyNumberFactory<double>;
+
+    BasicFuzzyNumber<double> a = Factory::triangular( 1, 2, 3 );
+    BasicFuzzyNumber<double> b = Factory::triangular( "2", "3", "4" );
+
+    EXPECT_EQ( a + b, Factory::triangular( 3, 5, 7 ) );
+    EXPECT_EQ( a - b, Factory::triangular( -3, -1, 1 ) );
+    EXPECT_EQ( a + 1, Factory::triangular( 2, 3, 4 ) );
+    EXPECT_EQ( a * 2, Factory::triangular( 2, 4, 6 ) );
+    EXPECT_EQ( -a, Factory::triangular( -3, -2, -1 ) );
+    EXPECT_EQ( a.alpha_cut( 0.5 ).interval(), BasicInterval<double>( 1.5, 2.5 ) );
+
+    BasicFuzzyNumber<long double> c = BasicFuzzyNumberFactory<long double>::trapezoidal( 1, 2, 3, 4 );
+    EXPECT_EQ( c.min(), 1.0L );
+    EXPECT_EQ( c.max(), 4.0L );
+
+#ifdef FUZZYMATH_HAS_FLOAT128
+    BasicFuzzyNumber<QuadFloat> d = BasicFuzzyNumberFactory<QuadFloat>::triangular( 1, 2, 3 );
+    EXPECT_EQ( d + d, BasicFuzzyNumberFactory<QuadFloat>::triangular( 2, 4, 6 ) );
+#endif
+}
+
 int main( int argc, char **argv )
 {
     testing::InitGoogleTest( &argc, argv );
@@ -0,0 +1,147 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <Functions.h>
+#include <FuzzyNumber.h>
+#include <FuzzyNumberBatch.h>
+#include <FuzzyNumberFactory.h>
+
+#include "gtest_extensions.h"
+
+using namespace FuzzyMath;
+
+class FuzzyNumberBatchTests : public ::testing::Test
+{
+  protected:
+    FuzzyNumber fn_a = FuzzyNumberFactory::triangular( 1, 2, 3 );
+    FuzzyNumber fn_b = FuzzyNumberFactory::triangular( 2, 3, 4 );
+    FuzzyNumber fn_c = FuzzyNumberFactory::triangular( -1, 0, 1 );
+    FuzzyNumber fn_g = FuzzyNumber( { AlphaCut( 0, Interval( 1, 5 ) ),
+                                      AlphaCut( PreciseFloat( "0.4" ), Interval( 2, 4 ) ),
+                                      AlphaCut( 1, Interval( 3, 3 ) ) } );
+
+    FuzzyNumberBatch batch_a = FuzzyNumberBatch( { fn_a, fn_b, fn_c } );
+    FuzzyNumberBatch batch_b = FuzzyNumberBatch( { fn_b, fn_b, fn_a } );
+};
+
+TEST_F( FuzzyNumberBatchTests, Creation )
+{
+    EXPECT_EQ( batch_a.size(), 3 );
+    EXPECT_EQ( batch_a.number_of_cuts(), 2 );
+    EXPECT_EQ( batch_a[0], fn_a );
+    EXPECT_EQ( batch_a[2], fn_c );
+    EXPECT_THAT( batch_a.fuzzy_numbers(), testing::ElementsAre( fn_a, fn_b, fn_c ) );
+
+    FuzzyNumberBatch batch =
+        FuzzyNumberBatch( { fn_a, fn_g }, { PreciseFloat( 0 ), PreciseFloat( "0.4" ), PreciseFloat( "0.5" ), 1 } );
+    EXPECT_EQ( batch.number_of_cuts(), 4 );
+    EXPECT_EQ( batch[0].alpha_cut( PreciseFloat( "0.4" ) ), fn_a.alpha_cut( PreciseFloat( "0.4" ) ) );
+    EXPECT_EQ( batch[1].alpha_cut( PreciseFloat( "0.5" ) ), fn_g.alpha_cut( PreciseFloat( "0.5" ) ) );
+    EXPECT_EQ( batch.lower_bounds( 1 )[1], PreciseFloat( 2 ) );
+    EXPECT_EQ( batch.upper_bounds( 1 )[1], PreciseFloat( 4 ) );
+
+    EXPECT_THROW( batch.lower_bounds( 2 ), std::out_of_range );
+}
+
+TEST( FuzzyNumberBatchTests_Standalone, CreationFail )
+{
+#ifdef FUZZYMATH_NO_VALIDATION
+    GTEST_SKIP() << "Validation is compiled out.";
+#endif
+
+    std::vector<PreciseFloat> alphas = { 0, 1 };
+
+    EXPECT_THROW( FuzzyNumberBatch( { 0, PreciseFloat( "0.5" ) }, { 1, 1 }, { 2, 2 } ), std::invalid_argument );
+    EXPECT_THROW( FuzzyNumberBatch( { 0, 1, 1 }, { 1, 1, 1 }, { 2, 2, 2 } ), std::invalid_argument );
+    EXPECT_THROW( FuzzyNumberBatch( alphas, { 1, 1, 1 }, { 2, 2, 2 } ), std::invalid_argument );
+    EXPECT_THROW( FuzzyNumberBatch( alphas, { 1, 0 }, { 2, 2 } ), std::invalid_argument );
+    EXPECT_THROW( FuzzyNumberBatch( alphas, { 3, 1 }, { 2, 2 } ), std::invalid_argument );
+}
+
+TEST( FuzzyNumberBatchTests_Standalone, Factory )
+{
+    std::vector<PreciseFloat> minimum = { 1, 2, -1 };
+    std::vector<PreciseFloat> kernel_minimum = { 2, 3, 0 };
+    std::vector<PreciseFloat> kernel_maximum = { 2, PreciseFloat( "3.5" ), 1 };
+    std::vector<PreciseFloat> maximum = { 3, 4, 1 };
+
+    FuzzyNumberBatch triangular = FuzzyNumberFactory::triangular_batch( minimum, kernel_minimum, maximum, 5 );
+    FuzzyNumberBatch trapezoidal =
+        FuzzyNumberFactory::trapezoidal_batch( minimum, kernel_minimum, kernel_maximum, maximum, 5 );
+    std::vector<FuzzyNumber> numbers =
+        FuzzyNumberFactory::trapezoidal( minimum, kernel_minimum, kernel_maximum, maximum );
+
+    ASSERT_EQ( triangular.size(), 3 );
+    ASSERT_EQ( numbers.size(), 3 );
+    EXPECT_EQ( triangular.number_of_cuts(), 5 );
+
+    for ( size_t i = 0; i < minimum.size(); ++i )
+    {
+        EXPECT_EQ( triangular[i], FuzzyNumberFactory::triangular( minimum[i], kernel_minimum[i], maximum[i], 5 ) );
+        EXPECT_EQ( trapezoidal[i], FuzzyNumberFactory::trapezoidal( minimum[i], kernel_minimum[i],
+                                                                    kernel_maximum[i], maximum[i], 5 ) );
+        EXPECT_EQ( numbers[i],
+                   FuzzyNumberFactory::trapezoidal( minimum[i], kernel_minimum[i], kernel_maximum[i], maximum[i] ) );
+    }
+
+    EXPECT_EQ( FuzzyNumberFactory::triangular( minimum, kernel_minimum, maximum, 3 ),
+               FuzzyNumberFactory::triangular_batch( minimum, kernel_minimum, maximum, 3 ).fuzzy_numbers() );
+
+    std::vector<PreciseFloat> short_column = { 1, 2 };
+    EXPECT_THROW( FuzzyNumberFactory::triangular_batch( minimum, short_column, maximum ), std::invalid_argument );
+    EXPECT_THROW( FuzzyNumberFactory::triangular_batch( maximum, kernel_minimum, minimum ), std::invalid_argument );
+    EXPECT_THROW( FuzzyNumberFactory::triangular_batch( minimum, kernel_minimum, maximum, 1 ), std::invalid_argument );
+}
+
+TEST_F( FuzzyNumberBatchTests, Arithmetic )
+{
+    std::vector<FuzzyNumber> sum = ( batch_a + batch_b ).fuzzy_numbers();
+    std::vector<FuzzyNumber> difference = ( batch_a - batch_b ).fuzzy_numbers();
+    std::vector<FuzzyNumber> product = ( batch_a * batch_b ).fuzzy_numbers();
+    std::vector<FuzzyNumber> quotient = ( batch_a / batch_b ).fuzzy_numbers();
+    std::vector<FuzzyNumber> negation = ( -batch_a ).fuzzy_numbers();
+
+    for ( size_t i = 0; i < batch_a.size(); ++i )
+    {
+        EXPECT_EQ( sum[i], batch_a[i] + batch_b[i] );
+        EXPECT_EQ( difference[i], batch_a[i] - batch_b[i] );
+        EXPECT_EQ( product[i], batch_a[i] * batch_b[i] );
+        EXPECT_EQ( quotient[i], batch_a[i] / batch_b[i] );
+        EXPECT_EQ( negation[i], -batch_a[i] );
+    }
+
+    EXPECT_THROW( batch_b / batch_a, std::domain_error );
+    EXPECT_THROW( batch_a + FuzzyNumberBatch( { fn_a } ), std::invalid_argument );
+    EXPECT_THROW( batch_a + FuzzyNumberBatch( { fn_a, fn_b, fn_c }, 3 ), std::invalid_argument );
+}
+
+TEST_F( FuzzyNumberBatchTests, Function )
+{
+    auto square = []( const PreciseFloat &x ) { return x * x; };
+
+    FuzzyNumberBatch result = batch_a.apply_function( square );
+
+    for ( size_t i = 0; i < batch_a.size(); ++i )
+    {
+        EXPECT_EQ( result[i], batch_a[i].apply_function( square ) );
+    }
+
+    EXPECT_EQ( result[2].min(), PreciseFloat( 0 ) );
+    EXPECT_EQ( result[2].max(), PreciseFloat( 1 ) );
+}
+
+TEST( FuzzyNumberBatchTests_Standalone, HardwareBackends )
+{
+    using Factory = BasicFuzzyNumberFactory<double>;
+
+    BasicFuzzyNumberBatch<double> a( { Factory::triangular( 1, 2, 3 ), Factory::triangular( 2, 3, 4 ) } );
+
+    EXPECT_EQ( ( a + a )[1], Factory::triangular( 4, 6, 8 ) );
+    EXPECT_EQ( ( a * a )[0], Factory::triangular( 1, 4, 9 ) );
+}
+
+int main( int argc, char **argv )
+{
+    testing::InitGoogleTest( &argc, argv );
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,156 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <FuzzyNumber.h>
+#include <FuzzyNumberFactory.h>
+#include <FuzzyNumberParser.h>
+
+#include "gtest_extensions.h"
+
+using namespace FuzzyMath;
+
+testing::Matcher<const ParseError &> IsError( size_t row, size_t column )
+{
+    return testing::AllOf( testing::Field( &ParseError::row, row ), testing::Field( &ParseError::column, column ) );
+}
+
+TEST( FuzzyNumberParserTests, Triangular )
+{
+    FuzzyNumberParser parser( RecordFormat::Triangular );
+    std::vector<ParseError> errors;
+
+    std::vector<FuzzyNumber> numbers = parser.parse( "1.5;2.0;3.5\n-1; 0 ;1e1\r\n\n+0.25;0.5;0.75", errors );
+
+    EXPECT_TRUE( errors.empty() );
+    EXPECT_THAT( numbers, testing::ElementsAre(
+                              FuzzyNumberFactory::triangular( PreciseFloat( "1.5" ), 2, PreciseFloat( "3.5" ) ),
+                              FuzzyNumberFactory::triangular( -1, 0, 10 ),
+                              FuzzyNumberFactory::triangular( PreciseFloat( "0.25" ), PreciseFloat( "0.5" ),
+                                                              PreciseFloat( "0.75" ) ) ) );
+    EXPECT_EQ( parser.row(), 4 );
+
+    BasicFuzzyNumberParser<PreciseFloat> parser_cuts( RecordFormat::Triangular, ',', 5 );
+    EXPECT_EQ( parser_cuts.parse( "1,2,3", errors ).front(), FuzzyNumberFactory::triangular( 1, 2, 3, 5 ) );
+}
+
+TEST( FuzzyNumberParserTests, Numbers )
+{
+    FuzzyNumberParser parser( RecordFormat::Trapezoidal );
+    std::vector<ParseError> errors;
+
+    // Fast path must give the same numbers as the string constructor.
+    std::vector<std::string> values = { "-0.000123",
+                                        "0.1",
+                                        "2.35",
+                                        "1234567.891e-2",
+                                        "12345678901234567890123.5",
+                                        "0.1234567890123456789012345",
+                                        "1E25" };
+
+    for ( const std::string &value : values )
+    {
+        std::vector<Interval> intervals = parser.parse_intervals( value + ";" + value, errors );
+
+        ASSERT_EQ( intervals.size(), 1 ) << value;
+        EXPECT_EQ( intervals[0].min(), PreciseFloat( value ) ) << value;
+    }
+
+    EXPECT_TRUE( errors.empty() );
+
+    BasicFuzzyNumberParser<double> double_parser( RecordFormat::Trapezoidal );
+    std::vector<BasicFuzzyNumber<double>> numbers = double_parser.parse( "+0.1;0.2;0.3;4e-1", errors );
+    ASSERT_EQ( numbers.size(), 1 );
+    EXPECT_EQ( numbers[0].min(), 0.1 );
+    EXPECT_EQ( numbers[0].max(), 0.4 );
+
+    BasicFuzzyNumberParser<long double> long_double_parser( RecordFormat::Trapezoidal );
+    EXPECT_EQ( long_double_parser.parse( "0.1;0.2;0.3;0.4", errors ).front().min(), 0.1L );
+    EXPECT_TRUE( errors.empty() );
+}
+
+TEST( FuzzyNumberParserTests, AlphaCuts )
+{
+    FuzzyNumberParser parser( RecordFormat::AlphaCuts );
+    std::vector<ParseError> errors;
+
+    std::vector<FuzzyNumber> numbers = parser.parse( "0;1;5;0.4;2;4;1;3;3", errors );
+
+    EXPECT_TRUE( errors.empty() );
+    ASSERT_EQ( numbers.size(), 1 );
+    EXPECT_EQ( numbers[0], FuzzyNumber( { AlphaCut( 0, Interval( 1, 5 ) ),
+                                          AlphaCut( PreciseFloat( "0.4" ), Interval( 2, 4 ) ),
+                                          AlphaCut( 1, Interval( 3, 3 ) ) } ) );
+
+    parser.parse( "0;1;5;1\n"
+                  "0.5;1;5;1;3;3\n"
+                  "0;1;5;0.4;0;4;1;3;3\n"
+                  "0;1;5;1;3;2\n"
+                  "0;1;5;0;2;4;1;3;3\n"
+                  "0;1;5;1;3;3;1;3;3",
+                  errors );
+
+    EXPECT_THAT( errors, testing::ElementsAre( IsError( 1, 8 ), IsError( 2, 1 ), IsError( 3, 11 ),
+                                               IsError( 4, 11 ), IsError( 5, 7 ), IsError( 6, 13 ) ) );
+}
+
+TEST( FuzzyNumberParserTests, Errors )
+{
+    FuzzyNumberParser parser( RecordFormat::Triangular );
+    std::vector<ParseError> errors;
+
+    std::vector<FuzzyNumber> numbers = parser.parse( "1;2;3\n"
+                                                     "1;x;3\n"
+                                                     "1;2\n"
+                                                     "1;2;3;4\n"
+                                                     "3;2;1\n"
+                                                     "1; 2 ;;\n"
+                                                     "1;2e;3\n"
+                                                     "4;5;6",
+                                                     errors );
+
+    EXPECT_EQ( numbers.size(), 2 );
+    EXPECT_THAT( errors, testing::ElementsAre( IsError( 2, 3 ), IsError( 3, 4 ), IsError( 4, 7 ), IsError( 5, 3 ),
+                                               IsError( 6, 7 ), IsError( 7, 3 ) ) );
+    EXPECT_STREQ( errors[0].message, "Field is not a number." );
+
+    EXPECT_THROW( FuzzyNumberParser( RecordFormat::Triangular, ';', 1 ), std::invalid_argument );
+}
+
+TEST( FuzzyNumberParserTests, Chunks )
+{
+    std::string text = "1;2;3\n2;3;4\n3;4;x\n4;5;6";
+
+    FuzzyNumberParser parser( RecordFormat::Triangular );
+    std::vector<FuzzyNumber> numbers;
+    std::vector<ParseError> errors;
+
+    // Buffer ends in the middle of the second line, which is passed again with the next chunk.
+    size_t consumed = parser.parse( std::string_view( text ).substr( 0, 9 ), numbers, errors, false );
+    EXPECT_EQ( consumed, 6 );
+    EXPECT_EQ( numbers.size(), 1 );
+
+    parser.parse( std::string_view( text ).substr( consumed ), numbers, errors );
+
+    EXPECT_EQ( numbers, parser.parse( text, errors ) );
+    EXPECT_THAT( errors, testing::ElementsAre( IsError( 3, 5 ), IsError( 3, 5 ) ) );
+
+    parser.reset();
+    EXPECT_EQ( parser.row(), 0 );
+}
+
+TEST( FuzzyNumberParserTests, Intervals )
+{
+    BasicFuzzyNumberParser<double> parser( RecordFormat::Triangular, '\t' );
+    std::vector<ParseError> errors;
+
+    std::vector<BasicInterval<double>> intervals = parser.parse_intervals( "1\t2\n5\t-1\n1\t2\t3", errors );
+
+    EXPECT_THAT( intervals, testing::ElementsAre( BasicInterval<double>( 1, 2 ), BasicInterval<double>( -1, 5 ) ) );
+    EXPECT_THAT( errors, testing::ElementsAre( IsError( 3, 5 ) ) );
+}
+
+int main( int argc, char **argv )
+{
+    testing::InitGoogleTest( &argc, argv );
+    return RUN_ALL_TESTS();
+}
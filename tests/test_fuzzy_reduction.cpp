@@ -0,0 +1,98 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <Functions.h>
+#include <FuzzyNumber.h>
+#include <FuzzyNumberFactory.h>
+#include <FuzzyReduction.h>
+
+#include "gtest_extensions.h"
+
+using namespace FuzzyMath;
+
+class FuzzyReductionTests : public ::testing::Test
+{
+  protected:
+    FuzzyNumber fn_a = FuzzyNumberFactory::triangular( 1, 2, 3 );
+    FuzzyNumber fn_b = FuzzyNumberFactory::triangular( -2, 3, 4, 3 );
+    FuzzyNumber fn_c = FuzzyNumberFactory::trapezoidal( 1, 2, 3, 6, 5 );
+    FuzzyNumber fn_d = FuzzyNumber( { AlphaCut( 0, Interval( 1, 5 ) ),
+                                      AlphaCut( PreciseFloat( "0.4" ), Interval( 2, 4 ) ),
+                                      AlphaCut( 1, Interval( 3, 3 ) ) } );
+
+    std::vector<FuzzyNumber> numbers() const { return { fn_a, fn_b, fn_c, fn_d }; }
+};
+
+TEST_F( FuzzyReductionTests, Sum )
+{
+    EXPECT_EQ( FuzzyReduction::sum( numbers() ), FuzzyNumber( fn_a + fn_b + fn_c + fn_d ) );
+    EXPECT_EQ( FuzzyReduction::sum( std::vector<FuzzyNumber>{ fn_b } ), fn_b );
+}
+
+TEST_F( FuzzyReductionTests, Product )
+{
+    EXPECT_EQ( FuzzyReduction::product( numbers() ), FuzzyNumber( fn_a * fn_b * fn_c * fn_d ) );
+}
+
+TEST_F( FuzzyReductionTests, WeightedSum )
+{
+    std::vector<PreciseFloat> weights = { PreciseFloat( 2 ), PreciseFloat( -3 ), PreciseFloat( "0.5" ),
+                                          PreciseFloat( 0 ) };
+
+    EXPECT_EQ( FuzzyReduction::weighted_sum( numbers(), weights ),
+               FuzzyNumber( fn_a * 2 + fn_b * -3 + fn_c * 0.5 + fn_d * 0 ) );
+
+    weights.pop_back();
+    EXPECT_THROW( FuzzyReduction::weighted_sum( numbers(), weights ), std::invalid_argument );
+}
+
+TEST_F( FuzzyReductionTests, Empty )
+{
+    EXPECT_THROW( FuzzyReduction::sum( std::vector<FuzzyNumber>() ), std::invalid_argument );
+    EXPECT_THROW( FuzzyReduction::product( std::vector<FuzzyNumber>() ), std::invalid_argument );
+}
+
+TEST( FuzzyReductionTests_Standalone, IndependentOfThreads )
+{
+    using Factory = BasicFuzzyNumberFactory<double>;
+    using Reduction = BasicFuzzyReduction<double>;
+
+    // More numbers than one block, with values that are not exact in binary, so the order of additions matters.
+    std::vector<BasicFuzzyNumber<double>> numbers;
+    std::vector<double> weights;
+
+    for ( int i = 0; i < 3000; ++i )
+    {
+        double center = 0.1 * ( i % 97 ) - 3.3;
+        numbers.push_back( Factory::triangular( center - 0.7, center, center + 0.3, 2 + i % 3 ) );
+        weights.push_back( 0.01 * ( i % 13 ) - 0.05 );
+    }
+
+    BasicFuzzyNumber<double> sum = Reduction::sum( numbers, 1 );
+    BasicFuzzyNumber<double> weighted_sum = Reduction::weighted_sum( numbers, weights, 1 );
+
+    for ( size_t threads : { 2, 3, 7, 64 } )
+    {
+        EXPECT_EQ( Reduction::sum( numbers, threads ), sum );
+        EXPECT_EQ( Reduction::weighted_sum( numbers, weights, threads ), weighted_sum );
+    }
+
+    BasicFuzzyNumber<double> folded = numbers.front();
+    for ( size_t i = 1; i < numbers.size(); ++i )
+        folded = folded + numbers[i];
+
+    ASSERT_EQ( sum.size(), folded.size() );
+    for ( size_t i = 0; i < sum.size(); ++i )
+    {
+        EXPECT_NEAR( sum.lower_bounds()[i], folded.lower_bounds()[i], 1e-9 );
+        EXPECT_NEAR( sum.upper_bounds()[i], folded.upper_bounds()[i], 1e-9 );
+    }
+}
+
+int main( int argc, char **argv )
+{
+    testing::InitGoogleTest( &argc, argv );
+    return RUN_ALL_TESTS();
+}
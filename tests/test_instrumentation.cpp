@@ -0,0 +1,119 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include <Functions.h>
+#include <FuzzyNumber.h>
+#include <FuzzyNumberFactory.h>
+#include <Instrumentation.h>
+
+#include "gtest_extensions.h"
+
+using namespace FuzzyMath;
+using Instrumentation::Counter;
+using Instrumentation::Timer;
+
+class InstrumentationTests : public ::testing::Test
+{
+  protected:
+    FuzzyNumber fn_a = FuzzyNumberFactory::triangular( 1, 2, 3 );
+    FuzzyNumber fn_b = FuzzyNumberFactory::triangular( 2, 3, 4, 3 );
+
+    void SetUp() override
+    {
+        if constexpr ( !Instrumentation::enabled )
+        {
+            GTEST_SKIP() << "Instrumentation is compiled out.";
+        }
+
+        Instrumentation::reset();
+    }
+
+    void TearDown() override { Instrumentation::enable_timers( false ); }
+};
+
+TEST( InstrumentationTests_Standalone, Disabled )
+{
+    if constexpr ( Instrumentation::enabled )
+    {
+        GTEST_SKIP() << "Instrumentation is compiled in.";
+    }
+
+    FuzzyNumber fn = FuzzyNumberFactory::triangular( 1, 2, 3 );
+    FuzzyNumber sum = fn + fn;
+    Instrumentation::enable_timers( true );
+    sum.alpha_cut( PreciseFloat( "0.5" ) );
+
+    EXPECT_FALSE( Instrumentation::timers_enabled() );
+    EXPECT_EQ( Instrumentation::snapshot()[Counter::FuzzyNumbers], 0 );
+    EXPECT_EQ( Instrumentation::snapshot()[Timer::AlphaCut].calls, 0 );
+
+    Instrumentation::enable_timers( false );
+}
+
+TEST_F( InstrumentationTests, Counters )
+{
+    // Alpha levels 0 and 1 of fn_a merged with 0, 0.5 and 1 of fn_b, 0.5 is interpolated on fn_a.
+    FuzzyNumber sum = fn_a + fn_b;
+
+    Instrumentation::Snapshot snapshot = Instrumentation::snapshot();
+    EXPECT_EQ( snapshot[Counter::AlphaLevels], 3 );
+    EXPECT_EQ( snapshot[Counter::Interpolations], 1 );
+    EXPECT_EQ( snapshot[Counter::FuzzyNumbers], 1 );
+    EXPECT_EQ( snapshot[Counter::Validations], 0 );
+
+    FuzzyNumber validated( { PreciseFloat( 0 ), PreciseFloat( 1 ) }, { PreciseFloat( 1 ), PreciseFloat( 2 ) },
+                           { PreciseFloat( 3 ), PreciseFloat( 2 ) } );
+    sum.apply_function( []( const PreciseFloat &x ) { return x * x; }, true );
+
+    snapshot = Instrumentation::snapshot();
+    EXPECT_EQ( snapshot[Counter::FuzzyNumbers], 3 );
+#ifndef FUZZYMATH_NO_VALIDATION
+    EXPECT_EQ( snapshot[Counter::Validations], 2 );
+#endif
+    EXPECT_EQ( snapshot[Counter::FunctionSamples], 2 * sum.size() );
+
+    Instrumentation::reset();
+    EXPECT_EQ( Instrumentation::snapshot()[Counter::FuzzyNumbers], 0 );
+}
+
+TEST_F( InstrumentationTests, ParallelSamples )
+{
+    Interval( 0, 1 ).apply_function_parallel( []( const PreciseFloat &x ) { return x; }, 100, 4 );
+
+    // Samples of helper threads are counted on the calling thread.
+    EXPECT_EQ( Instrumentation::snapshot()[Counter::FunctionSamples], 101 );
+}
+
+TEST_F( InstrumentationTests, ThreadLocal )
+{
+    std::thread( [this]() { FuzzyNumber sum = fn_a + fn_b; } ).join();
+
+    EXPECT_EQ( Instrumentation::snapshot()[Counter::FuzzyNumbers], 0 );
+}
+
+TEST_F( InstrumentationTests, Timers )
+{
+    fn_a.alpha_cut( PreciseFloat( "0.5" ) );
+    EXPECT_EQ( Instrumentation::snapshot()[Timer::AlphaCut].calls, 0 );
+
+    Instrumentation::enable_timers( true );
+    EXPECT_TRUE( Instrumentation::timers_enabled() );
+
+    fn_a.alpha_cut( PreciseFloat( "0.5" ) );
+    FuzzyNumber sum = fn_a + fn_b;
+    FuzzyNumber square = fn_a.apply_function( []( const PreciseFloat &x ) { return x * x; } );
+
+    Instrumentation::Snapshot snapshot = Instrumentation::snapshot();
+    EXPECT_EQ( snapshot[Timer::AlphaCut].calls, 1 );
+    EXPECT_EQ( snapshot[Timer::Operation].calls, 1 );
+    EXPECT_EQ( snapshot[Timer::ApplyFunction].calls, 1 );
+    EXPECT_GT( snapshot[Timer::ApplyFunction].elapsed.count(), 0 );
+}
+
+int main( int argc, char **argv )
+{
+    testing::InitGoogleTest( &argc, argv );
+    return RUN_ALL_TESTS();
+}
@@ -200,6 +200,40 @@ TEST_F( IntervalTests, Multiply )
     r = a * b;
     ASSERT_EQ( r.min(), a.min() * b.min() );
     ASSERT_EQ( r.max(), a.max() * b.max() );
+
+    r = d * -2;
+    ASSERT_EQ( r.min(), d.max() * -2 );
+    ASSERT_EQ( r.max(), d.min() * -2 );
+
+    r = d * PreciseFloat( "0.5" );
+    ASSERT_EQ( r.min(), d.min() / 2 );
+    ASSERT_EQ( r.max(), d.max() / 2 );
+}
+
+TEST( Interval, MultiplyDivideSignCases )
+{
+    std::vector<Interval> intervals = {
+        Interval( 2, 5 ),  Interval( 0, 3 ),  Interval( -4, -1 ), Interval( -3, 0 ),   Interval( -2, 3 ),
+        Interval( -5, 1 ), Interval( 2 ),     Interval( -1.5 ),   Interval( "0", "0" ), Interval( "0.1", "0.7" ),
+    };
+
+    auto hull = []( std::initializer_list<PreciseFloat> values )
+    { return Interval( std::min( values ), std::max( values ) ); };
+
+    for ( const Interval &x : intervals )
+    {
+        for ( const Interval &y : intervals )
+        {
+            EXPECT_EQ( x * y, hull( { x.min() * y.min(), x.min() * y.max(), x.max() * y.min(), x.max() * y.max() } ) )
+                << x.to_string() << " * " << y.to_string();
+
+            if ( y.contains( PreciseFloat( 0 ) ) )
+                continue;
+
+            EXPECT_EQ( x / y, hull( { x.min() / y.min(), x.min() / y.max(), x.max() / y.min(), x.max() / y.max() } ) )
+                << x.to_string() << " / " << y.to_string();
+        }
+    }
 }
 
 TEST_F( IntervalTests, Divide )
@@ -216,7 +250,12 @@ TEST_F( IntervalTests, Divide )
     ASSERT_EQ( r.min(), a.min() / b.max() );
     ASSERT_EQ( r.max(), a.max() / b.min() );
 
+    r = d / -2;
+    ASSERT_EQ( r.min(), d.max() / -2 );
+    ASSERT_EQ( r.max(), d.min() / -2 );
+
     ASSERT_THROW( a / 0.0, std::domain_error );
+    ASSERT_THROW( a / PreciseFloat( 0 ), std::domain_error );
     ASSERT_THROW( a / d, std::domain_error );
 }
 
@@ -262,6 +301,110 @@ TEST_F( IntervalTests, apply_function )
     ASSERT_NEAR( r.max_as_double(), 0.28366218546322625, 1e-7 );
 }
 
+TEST_F( IntervalTests, apply_function_callables )
+{
+    std::function<PreciseFloat( const PreciseFloat & )> square = []( const PreciseFloat &x ) { return x * x; };
+    EXPECT_EQ( d.apply_function( square ), Interval( 0, 9 ) );
+    EXPECT_EQ( d.apply_function( []( const PreciseFloat &x ) { return x * x; } ), Interval( 0, 9 ) );
+
+    PreciseFloat offset = 2;
+    EXPECT_EQ( a.apply_function( [&offset]( const PreciseFloat &x ) { return x + offset; }, true ), Interval( 3, 5 ) );
+
+    BasicInterval<double> h = BasicInterval<double>( -2, 3 );
+    EXPECT_EQ( h.apply_function( static_cast<double ( * )( double )>( std::fabs ) ), BasicInterval<double>( 0, 3 ) );
+}
+
+TEST_F( IntervalTests, apply_function_parallel )
+{
+    auto wave = []( const PreciseFloat &x ) { return sin( x * 3 ) * x; };
+
+    Interval serial = d.apply_function( wave, false, 101 );
+
+    for ( size_t threads : { 0, 1, 3, 8, 500 } )
+    {
+        EXPECT_EQ( d.apply_function_parallel( wave, 101, threads ), serial );
+    }
+
+    EXPECT_EQ( d.apply_function_parallel( []( const PreciseFloat &x ) { return x * x; }, 1, 4 ), Interval( 0.25, 9 ) );
+    EXPECT_TRUE( f.apply_function_parallel( wave ).is_empty() );
+
+    auto failing = []( const PreciseFloat &x ) -> PreciseFloat
+    {
+        if ( x > 0 )
+            throw std::domain_error( "positive" );
+        return x;
+    };
+    EXPECT_THROW( d.apply_function_parallel( failing, 100, 4 ), std::domain_error );
+}
+
+TEST( Interval, apply_function_bounded )
+{
+    BasicInterval<double> x = BasicInterval<double>( -2, 3 );
+    size_t evaluations = 0;
+
+    auto square = [&evaluations]( double v )
+    {
+        ++evaluations;
+        return v * v;
+    };
+    auto square_extension = []( const BasicInterval<double> &box ) { return box.power( 2 ); };
+
+    BasicInterval<double> r = x.apply_function_bounded( square, square_extension, 1e-6 );
+    EXPECT_LE( r.min(), 0 );
+    EXPECT_GE( r.min(), -1e-6 );
+    EXPECT_EQ( r.max(), 9 );
+    EXPECT_LT( evaluations, 100 );
+
+    // Spike of width 2e-5 lies between samples of apply_function, but is found by branch and bound.
+    double centre = 0.1234567;
+    double width = 1e-5;
+    auto spike = [=]( double v ) { return std::max( 0.0, 1 - std::fabs( v - centre ) / width ); };
+    auto spike_extension = [=]( const BasicInterval<double> &box )
+    {
+        double nearest = std::min( std::fabs( box.min() - centre ), std::fabs( box.max() - centre ) );
+        nearest = box.contains( centre ) ? 0 : nearest;
+        double farthest = std::max( std::fabs( box.min() - centre ), std::fabs( box.max() - centre ) );
+        return BasicInterval<double>( std::max( 0.0, 1 - farthest / width ), std::max( 0.0, 1 - nearest / width ) );
+    };
+
+    EXPECT_EQ( x.apply_function( spike ).max(), 0 );
+
+    r = x.apply_function_bounded( spike, spike_extension, 1e-3 );
+    EXPECT_EQ( r.min(), 0 );
+    EXPECT_GE( r.max(), 1 );
+    EXPECT_LE( r.max(), 1 + 1e-3 );
+
+    EXPECT_TRUE( BasicInterval<double>().apply_function_bounded( spike, spike_extension, 1e-3 ).is_empty() );
+    EXPECT_EQ( BasicInterval<double>( 2 ).apply_function_bounded( square, square_extension, 1e-3 ),
+               BasicInterval<double>( 4 ) );
+}
+
+TEST( Interval, apply_function_lipschitz )
+{
+    BasicInterval<double> x = BasicInterval<double>( 0, 4 );
+    auto sin = []( double v ) { return std::sin( v ); };
+
+    BasicInterval<double> r = x.apply_function_lipschitz( sin, 1, 1e-4 );
+    EXPECT_LE( r.min(), std::sin( 4.0 ) );
+    EXPECT_GE( r.min(), std::sin( 4.0 ) - 1e-4 );
+    EXPECT_GE( r.max(), 1 );
+    EXPECT_LE( r.max(), 1 + 1e-4 );
+
+    // Limited number of bisections still gives an enclosure.
+    r = x.apply_function_lipschitz( sin, 1, 1e-4, 3 );
+    EXPECT_LE( r.min(), std::sin( 4.0 ) );
+    EXPECT_GE( r.max(), 1 );
+
+    Interval y = Interval( -1, 2 );
+    auto cube = []( const PreciseFloat &v ) { return v * v * v; };
+    Interval precise = y.apply_function_lipschitz( cube, 12, PreciseFloat( "1e-6" ) );
+    EXPECT_LE( precise.min(), PreciseFloat( -1 ) );
+    EXPECT_GE( precise.max(), PreciseFloat( 8 ) );
+    EXPECT_LE( precise.max(), PreciseFloat( "8.000001" ) );
+
+    EXPECT_THROW( x.apply_function_lipschitz( sin, -1, 1e-4 ), std::invalid_argument );
+}
+
 TEST_F( IntervalTests, Negative )
 {
     Interval r = -a;
@@ -320,3 +463,26 @@ TEST_F( IntervalTests, Power )
     ASSERT_EQ( r.min(), -8 );
     ASSERT_EQ( r.max(), 27 );
 }
+
+TEST( Interval, HardwareBackends )
+{
+    BasicInterval<double> a = BasicInterval<double>( 1, 3 );
+    BasicInterval<double> b = BasicInterval<double>( "2", "5" );
+
+    EXPECT_EQ( a + b, BasicInterval<double>( 3, 8 ) );
+    EXPECT_EQ( a - b, BasicInterval<double>( -4, 1 ) );
+    EXPECT_EQ( a * b, BasicInterval<double>( 2, 15 ) );
+    EXPECT_EQ( a / 2, BasicInterval<double>( 0.5, 1.5 ) );
+    EXPECT_EQ( 1 + a, BasicInterval<double>( 2, 4 ) );
+    EXPECT_EQ( a.power( 2 ), BasicInterval<double>( 1, 9 ) );
+    EXPECT_TRUE( BasicInterval<double>().is_empty() );
+    EXPECT_THROW( BasicInterval<double>( "a", "1" ), std::runtime_error );
+
+    BasicInterval<long double> c = BasicInterval<long double>( 1, 3 );
+    EXPECT_EQ( c * c, BasicInterval<long double>( 1, 9 ) );
+
+#ifdef FUZZYMATH_HAS_FLOAT128
+    BasicInterval<QuadFloat> d = BasicInterval<QuadFloat>( "1.5", "2.5" );
+    EXPECT_EQ( d + d, BasicInterval<QuadFloat>( 3, 5 ) );
+#endif
+}
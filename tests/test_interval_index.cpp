@@ -0,0 +1,118 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include <FuzzyNumber.h>
+#include <FuzzyNumberFactory.h>
+#include <IntervalIndex.h>
+
+#include "gtest_extensions.h"
+
+using namespace FuzzyMath;
+
+class IntervalIndexTests : public ::testing::Test
+{
+  protected:
+    std::vector<FuzzyNumber> numbers = { FuzzyNumberFactory::triangular( 1, 2, 3 ),
+                                         FuzzyNumberFactory::trapezoidal( 0, 4, 5, 9 ),
+                                         FuzzyNumberFactory::triangular( 6, 7, 8 ),
+                                         FuzzyNumberFactory::crisp_number( 3 ) };
+    IntervalIndex index = IntervalIndex( numbers );
+};
+
+TEST_F( IntervalIndexTests, Stabbing )
+{
+    EXPECT_EQ( index.size(), 4 );
+    std::span<const PreciseFloat> levels = index.alpha_levels();
+    EXPECT_EQ( std::vector<PreciseFloat>( levels.begin(), levels.end() ), std::vector<PreciseFloat>( { 0, 1 } ) );
+
+    EXPECT_EQ( index.stabbing( PreciseFloat( 3 ) ), std::vector<size_t>( { 0, 1, 3 } ) );
+    EXPECT_EQ( index.stabbing( PreciseFloat( 7 ), PreciseFloat( 1 ) ), std::vector<size_t>( { 2 } ) );
+    EXPECT_TRUE( index.stabbing( PreciseFloat( 10 ) ).empty() );
+    EXPECT_EQ( index.stabbing( PreciseFloat( 3 ), PreciseFloat( 1 ) ), std::vector<size_t>( { 3 } ) );
+
+    EXPECT_THROW( index.stabbing( PreciseFloat( 3 ), PreciseFloat( "0.5" ) ), std::invalid_argument );
+}
+
+TEST_F( IntervalIndexTests, Overlapping )
+{
+    EXPECT_EQ( index.overlapping( Interval( 3, 6 ) ), std::vector<size_t>( { 0, 1, 2, 3 } ) );
+    EXPECT_EQ( index.overlapping( Interval( 3, 6 ), PreciseFloat( 1 ) ), std::vector<size_t>( { 1, 3 } ) );
+    EXPECT_TRUE( index.overlapping( Interval() ).empty() );
+}
+
+TEST_F( IntervalIndexTests, Contained )
+{
+    EXPECT_EQ( index.contained( Interval( 2, 5 ) ), std::vector<size_t>( { 0, 1, 3 } ) );
+    EXPECT_EQ( index.contained( Interval( 1, 3 ), PreciseFloat( 0 ) ), std::vector<size_t>( { 0, 3 } ) );
+
+    IntervalIndex middle( numbers, { PreciseFloat( "0.5" ) } );
+    EXPECT_EQ( middle.contained( Interval( 1, 3 ), PreciseFloat( "0.5" ) ), std::vector<size_t>( { 0, 3 } ) );
+    EXPECT_THROW( middle.contained( Interval( 1, 3 ) ), std::invalid_argument );
+}
+
+TEST( IntervalIndexTests_Standalone, AgainstBruteForce )
+{
+    using Factory = BasicFuzzyNumberFactory<double>;
+    using Index = BasicIntervalIndex<double>;
+
+    std::mt19937 generator( 7 );
+    std::uniform_real_distribution<double> position( 0, 100 );
+    std::uniform_real_distribution<double> width( 0, 5 );
+
+    std::vector<double> levels = { 0, 0.25, 1 };
+
+    // Sizes around powers of two exercise subtrees cut off by the end of arrays.
+    for ( size_t count : { 0, 1, 2, 3, 15, 16, 17, 100, 1000, 1025 } )
+    {
+        std::vector<BasicFuzzyNumber<double>> numbers;
+
+        for ( size_t i = 0; i < count; ++i )
+        {
+            double kernel_minimum = position( generator );
+            double kernel_maximum = kernel_minimum + width( generator );
+            numbers.push_back( Factory::trapezoidal( kernel_minimum - width( generator ), kernel_minimum,
+                                                     kernel_maximum, kernel_maximum + width( generator ),
+                                                     2 + generator() % 3 ) );
+        }
+
+        Index index( numbers, levels );
+
+        for ( int query = 0; query < 50; ++query )
+        {
+            double a = position( generator );
+            BasicInterval<double> window( a, a + width( generator ) );
+
+            for ( double alpha : levels )
+            {
+                std::vector<size_t> stabbing;
+                std::vector<size_t> overlapping;
+                std::vector<size_t> contained;
+
+                for ( size_t i = 0; i < count; ++i )
+                {
+                    BasicInterval<double> cut = numbers[i].alpha_cut( alpha ).interval();
+
+                    if ( cut.contains( a ) )
+                        stabbing.push_back( i );
+                    if ( cut.intersects( window ) )
+                        overlapping.push_back( i );
+                    if ( window.contains( cut ) )
+                        contained.push_back( i );
+                }
+
+                EXPECT_EQ( index.stabbing( a, alpha ), stabbing );
+                EXPECT_EQ( index.overlapping( window, alpha ), overlapping );
+                EXPECT_EQ( index.contained( window, alpha ), contained );
+            }
+        }
+    }
+}
+
+int main( int argc, char **argv )
+{
+    testing::InitGoogleTest( &argc, argv );
+    return RUN_ALL_TESTS();
+}
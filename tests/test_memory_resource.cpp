@@ -0,0 +1,124 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <memory_resource>
+#include <thread>
+
+#include <ExtensionPrinciple.h>
+#include <Functions.h>
+#include <FuzzyNumber.h>
+#include <FuzzyNumberFactory.h>
+#include <MemoryResource.h>
+
+#include "gtest_extensions.h"
+
+using namespace FuzzyMath;
+
+// Resource counting allocations, memory comes from the default resource.
+class CountingResource : public std::pmr::memory_resource
+{
+  public:
+    size_t allocations = 0;
+    size_t deallocations = 0;
+
+  private:
+    void *do_allocate( size_t bytes, size_t alignment ) override
+    {
+        ++allocations;
+        return std::pmr::get_default_resource()->allocate( bytes, alignment );
+    }
+
+    void do_deallocate( void *p, size_t bytes, size_t alignment ) override
+    {
+        ++deallocations;
+        std::pmr::get_default_resource()->deallocate( p, bytes, alignment );
+    }
+
+    bool do_is_equal( const std::pmr::memory_resource &other ) const noexcept override { return this == &other; }
+};
+
+class MemoryResourceTests : public ::testing::Test
+{
+  protected:
+    FuzzyNumber fn_a = FuzzyNumberFactory::triangular( 1, 2, 3 );
+    FuzzyNumber fn_b = FuzzyNumberFactory::triangular( 2, 3, 4, 3 );
+};
+
+TEST_F( MemoryResourceTests, ScopedResource )
+{
+    EXPECT_EQ( memory_resource(), std::pmr::get_default_resource() );
+
+    CountingResource counting;
+    FuzzyNumber copy = fn_a;
+
+    {
+        ScopedMemoryResource scope( &counting );
+        EXPECT_EQ( memory_resource(), &counting );
+
+        FuzzyNumber sum = fn_a + fn_b;
+        EXPECT_EQ( sum, FuzzyNumberFactory::triangular( 3, 5, 7, 3 ) );
+        EXPECT_GT( counting.allocations, 0 );
+
+        // Copies are allocated from the default resource.
+        size_t allocations = counting.allocations;
+        copy = sum;
+        FuzzyNumber another_copy = sum;
+        EXPECT_EQ( counting.allocations, allocations );
+
+        {
+            CountingResource inner;
+            ScopedMemoryResource inner_scope( &inner );
+            FuzzyNumber negation = -sum;
+            EXPECT_GT( inner.allocations, 0 );
+        }
+
+        EXPECT_EQ( memory_resource(), &counting );
+    }
+
+    EXPECT_EQ( counting.allocations, counting.deallocations );
+    EXPECT_EQ( memory_resource(), std::pmr::get_default_resource() );
+    EXPECT_EQ( copy, FuzzyNumberFactory::triangular( 3, 5, 7, 3 ) );
+}
+
+TEST_F( MemoryResourceTests, Arena )
+{
+    auto square_function = []( const PreciseFloat &x ) { return x * x; };
+    FuzzyNumber result = fn_a;
+
+    {
+        ScopedArena arena( 1024 );
+        EXPECT_EQ( memory_resource(), arena.resource() );
+
+        FuzzyNumber square = fn_a.apply_function( square_function, true );
+        FuzzyNumber product = apply_function( []( std::span<const PreciseFloat> x ) { return x[0] * x[1]; },
+                                              { fn_a, fn_b }, true );
+
+        // Result is copied out of the arena before it is released.
+        result = square * product + fn_b;
+    }
+
+    EXPECT_EQ( memory_resource(), std::pmr::get_default_resource() );
+    FuzzyNumber square = fn_a.apply_function( square_function, true );
+    EXPECT_EQ( result, square * ( fn_a * fn_b ) + fn_b );
+}
+
+TEST_F( MemoryResourceTests, ThreadLocal )
+{
+    CountingResource counting;
+    ScopedMemoryResource scope( &counting );
+
+    std::pmr::memory_resource *other_thread = nullptr;
+    std::thread( [&other_thread]() { other_thread = memory_resource(); } ).join();
+
+    EXPECT_EQ( other_thread, std::pmr::get_default_resource() );
+
+    // Parallel sampling allocates from resource of the calling thread only on that thread.
+    Interval( 0, 1 ).apply_function_parallel( []( const PreciseFloat &x ) { return x * x; }, 100, 4 );
+    EXPECT_EQ( counting.allocations, counting.deallocations );
+}
+
+int main( int argc, char **argv )
+{
+    testing::InitGoogleTest( &argc, argv );
+    return RUN_ALL_TESTS();
+}